@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+import argparse
+import os
+import re
+import subprocess
+import sys
+import time
+
+# generates translation units with apps of n args and reports compile time and peak memory of the compiler,
+# with --modules the same apps importing the argless module are compared against the single header
+
+def generate(count, gets, module=False):
+    lines = ["import argless;" if module else "#include <argless.hpp>", "", "using app = argless::app<\"CompileBench\", argless::nodesc, argless::accumulate<const char*>,"]
+
+    args = []
+    for i in range(count):
+        kind = ("void", "int", "const char*")[i % 3]
+        alias = f", argless::nodesc, \"-a{i}\"" if i % 2 == 0 else ""
+        args.append(f"\targless::arg<{kind}, \"--arg-{i}\"{alias}>")
+    lines.append(",\n".join(args))
+    lines.append(">;")
+    lines.append("")
+    lines.append("int main(int argc, const char** argv)")
+    lines.append("{")
+    lines.append("\tauto result = app::parse(argc, argv);")
+    lines.append("\tint sum = static_cast<bool>(result.error());")
+    step = max(1, count // gets) if gets else 0
+    for i in (range(0, count, step) if step else []):
+        lines.append(f"\tsum += static_cast<bool>(result.get<\"--arg-{i}\">());")
+    lines.append("\treturn sum;")
+    lines.append("}")
+    return "\n".join(lines) + "\n"
+
+def run(command, cwd=None):
+    start = time.perf_counter()
+    process = subprocess.Popen(command, stderr=subprocess.PIPE, cwd=cwd)
+    _, status, usage = os.wait4(process.pid, 0)
+    elapsed = time.perf_counter() - start
+    errors = process.stderr.read().decode(errors="replace")
+    process.stderr.close()
+    if os.waitstatus_to_exitcode(status) != 0:
+        print(errors, file=sys.stderr)
+        return None
+    # ru_maxrss is in kilobytes on linux
+    return elapsed, usage.ru_maxrss / 1024
+
+def compile_unit(compiler, flags, source, output, cwd=None):
+    return run([compiler] + flags + ["-c", source, "-o", output], cwd)
+
+# module interface units of a directory in dependency order, (module name, path)
+def module_units(directory):
+    units = {}
+    for file in sorted(os.listdir(directory)):
+        if not file.endswith(".cppm"):
+            continue
+        path = os.path.join(directory, file)
+        with open(path) as f:
+            text = f.read()
+        name = re.search(r"^export module ([\w.:]+);", text, re.M).group(1)
+        primary = name.split(":")[0]
+        imports = [(m.group(1) or primary) + (m.group(2) or "") for m in re.finditer(r"^(?:export )?import ([\w.]*)(:[\w.]+)?;", text, re.M)]
+        units[name] = (path, imports)
+
+    order = []
+    def visit(name):
+        if name in order or name not in units:
+            return
+        for dependency in units[name][1]:
+            visit(dependency)
+        order.append(name)
+    for name in units:
+        visit(name)
+    return [(name, units[name][0]) for name in order]
+
+# gcc keeps compiled interfaces in gcm.cache of the working directory, clang gets prebuilt .pcm files
+def module_flags(compiler, out):
+    version = subprocess.run([compiler, "--version"], stdout=subprocess.PIPE).stdout.decode(errors="replace")
+    if "clang" in version:
+        return "clang", [f"-fprebuilt-module-path={out}"]
+    return "gcc", ["-fmodules-ts"]
+
+def build_modules(compiler, flags, directory, out):
+    kind, extra = module_flags(compiler, out)
+    total, peak = 0.0, 0.0
+    for name, path in module_units(directory):
+        if kind == "clang":
+            command = [compiler] + flags + extra + ["--precompile", "-x", "c++-module", path, "-o", os.path.join(out, name.replace(":", "-") + ".pcm")]
+        else:
+            command = [compiler] + flags + extra + ["-x", "c++", "-c", path, "-o", os.path.join(out, name.replace(":", "-") + ".o")]
+        result = run(command, out)
+        if result is None:
+            print(f"module {name} failed", file=sys.stderr)
+            return None
+        total += result[0]
+        peak = max(peak, result[1])
+    return total, peak, extra
+
+def main():
+    parser = argparse.ArgumentParser(description="argless compile-time benchmark")
+    parser.add_argument("--compiler", default=os.environ.get("CXX", "c++"))
+    parser.add_argument("--include", action="append", default=[], help="include directory (repeatable)")
+    parser.add_argument("--out", default="compile_bench")
+    parser.add_argument("--sizes", default="100,250,500,1000,2000", help="arg counts")
+    parser.add_argument("--gets", type=int, default=50, help="result.get<> calls per unit")
+    parser.add_argument("--flags", default="-std=c++20 -O0", help="compiler flags")
+    parser.add_argument("--modules", help="module_src directory, compares import argless against the header")
+    args = parser.parse_args()
+
+    out = os.path.abspath(args.out)
+    os.makedirs(out, exist_ok=True)
+    flags = args.flags.split() + [f"-I{os.path.abspath(d)}" for d in args.include]
+
+    modules = None
+    if args.modules:
+        modules = build_modules(args.compiler, flags, os.path.abspath(args.modules), out)
+        if modules is None:
+            return 1
+        print(f"module interfaces: {modules[0]:.2f} seconds, {modules[1]:.1f} peak MiB (built once)")
+
+    print(f"{'args':>6} {'seconds':>10} {'peak MiB':>10}" + (f" {'import s':>10} {'import MiB':>10}" if modules else ""))
+    for size in (int(s) for s in args.sizes.split(",")):
+        source = os.path.join(out, f"app_{size}.cpp")
+        with open(source, "w") as f:
+            f.write(generate(size, args.gets))
+
+        result = compile_unit(args.compiler, flags, source, os.path.join(out, f"app_{size}.o"))
+        if result is None:
+            print(f"{size:>6} {'failed':>10}")
+            return 1
+        line = f"{size:>6} {result[0]:>10.2f} {result[1]:>10.1f}"
+
+        if modules:
+            source = os.path.join(out, f"app_{size}_import.cpp")
+            with open(source, "w") as f:
+                f.write(generate(size, args.gets, True))
+            result = compile_unit(args.compiler, flags + modules[2], source, os.path.join(out, f"app_{size}_import.o"), out)
+            line += f" {result[0]:>10.2f} {result[1]:>10.1f}" if result else f" {'failed':>10}"
+
+        print(line, flush=True)
+
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
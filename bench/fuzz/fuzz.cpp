@@ -0,0 +1,355 @@
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+#define ARGLESS_STDH_ALL
+#include <argless.hpp>
+
+// fuzz target for libFuzzer (-DARGLESS_FUZZ_LIBFUZZER -fsanitize=fuzzer) and AFL++ (file argument, @@),
+// without libFuzzer main() replays files and directories and can mutate them offline (--runs n)
+//
+// input: first byte picks the app, the bytes right after it are argv tokens separated by '\n' or '\0' (an input of only the app byte has none)
+// a parse slower than ARGLESS_FUZZ_NS_PER_TOKEN ns per token (plus ARGLESS_FUZZ_NS_FIXED) aborts like a crash,
+// both are also read from the environment so sanitizer builds can raise them
+
+#ifndef ARGLESS_FUZZ_NS_PER_TOKEN
+#define ARGLESS_FUZZ_NS_PER_TOKEN 20000
+#endif
+
+#ifndef ARGLESS_FUZZ_NS_FIXED
+#define ARGLESS_FUZZ_NS_FIXED 500000
+#endif
+
+enum class fuzz_enum { a, b, c };
+
+template <>
+struct argless::enum_refl<fuzz_enum>
+{
+	using values = argless::enum_values<
+		argless::enum_value<"alpha", fuzz_enum::a>,
+		argless::enum_value<"beta", fuzz_enum::b>,
+		argless::enum_value<"gamma", fuzz_enum::c>
+	>;
+};
+
+// tuple backtracking, splits of the value tokens between the elements (nested --n repeats the search per level)
+using tuple_app = argless::app<"Tuples", argless::nodesc, argless::accumulate<const char*>,
+	argless::arg<std::tuple<std::vector<int>, int, int>, "--t">,
+	argless::arg<std::tuple<std::optional<int>, std::list<float>, std::string>, "--u">,
+	argless::arg<std::tuple<std::tuple<float, std::variant<std::list<std::array<int, 2>>, std::list<int>>, int>, int>, "--n">
+>;
+
+// variants of lists, every alternative is tried on the whole value
+using variant_app = argless::app<"Variants", argless::nodesc, argless::accumulate<int>,
+	argless::arg<std::variant<std::list<int>, std::vector<float>, std::deque<std::string>>, "--v">,
+	argless::arg<std::vector<std::variant<int, std::tuple<int, int>, std::string>>, "--w">,
+	argless::arg<std::variant<bool, std::variant<int, std::variant<float, std::variant<std::tuple<int, int>, std::string>>>>, "--d">
+>;
+
+// fallback values when the parse fails, transform and validate on top of composites
+using fallback_app = argless::app<"Fallbacks", argless::nodesc, void,
+	argless::arg<argless::fallback<int, 7>, "--i">,
+	argless::arg<argless::fallback<std::vector<int>, []{ return std::vector<int>{ 1, 2 }; }>, "--l">,
+	argless::arg<argless::fallback<std::tuple<std::vector<int>, fuzz_enum>, []{ return std::tuple<std::vector<int>, fuzz_enum>{}; }>, "--e">,
+	argless::arg<argless::validate<[](const std::vector<int>& v) { return v.size() % 2 == 0; }>, "--even">,
+	argless::arg<argless::transform<[](std::tuple<int, std::vector<float>> t) { return std::get<0>(t); }>, "--x">
+>;
+
+// name matching: abbreviations, negatable flags, repeat policies, groups and pages
+using flags_app = argless::app<"Flags", argless::nodesc, argless::accumulate<const char*>,
+	argless::abbreviations,
+	argless::arg<argless::negatable<>, "--color", argless::nodesc, "-c", "--colour">,
+	argless::arg<argless::repeat<std::vector<std::string>, argless::repeat_policy::last_wins>, "--list">,
+	argless::arg<argless::repeat<std::vector<int>, argless::repeat_policy::merge>, "--ids">,
+	argless::arg<argless::repeat<void, argless::repeat_policy::first_wins>, "--verbose", argless::nodesc, "-v">,
+	argless::arg<argless::option<"fast", "slow", "auto">, "--speed">,
+	argless::arg<unsigned int, "--jobs", argless::nodesc, "-j">,
+	argless::arg<void, "--json">,
+	argless::arg<void, "--yaml", argless::nodesc, "-y">,
+	argless::exclusive<"--json", "-y">,
+	argless::page<"build", argless::nodesc, argless::accumulate<const char*>,
+		argless::arg<argless::required<const char*>, "--target">,
+		argless::arg<void, "-v">
+	>,
+	argless::page<"run", argless::nodesc, void,
+		argless::arg<int, "--times">,
+		argless::page<"fast", argless::nodesc, void, argless::arg<void, "--x">>
+	>
+>;
+
+namespace fuzz {
+
+inline long long limit_from(const char* name, long long fallback)
+{
+	const char* value = std::getenv(name);
+	return value && *value ? std::atoll(value) : fallback;
+}
+
+inline const long long ns_per_token = limit_from("ARGLESS_FUZZ_NS_PER_TOKEN", ARGLESS_FUZZ_NS_PER_TOKEN);
+inline const long long ns_fixed = limit_from("ARGLESS_FUZZ_NS_FIXED", ARGLESS_FUZZ_NS_FIXED);
+
+template <typename app>
+inline long long parse_ns(int argc, const char** argv, bool& parsed)
+{
+	auto start = std::chrono::steady_clock::now();
+	auto result = app::parse(argc, argv);
+	auto end = std::chrono::steady_clock::now();
+	asm volatile("" : : "g"(&result) : "memory");
+	parsed = !result.error();
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+
+// fastest of a few runs, one slow run is scheduling noise, returns whether the parse succeeded
+template <typename app>
+inline bool check(int argc, const char** argv)
+{
+	bool parsed = false;
+	long long limit = ns_fixed + ns_per_token * (argc - 1);
+	long long best = parse_ns<app>(argc, argv, parsed);
+	for (int i = 0; i < 2 && best > limit; ++i)
+		best = std::min(best, parse_ns<app>(argc, argv, parsed));
+
+	if (best > limit)
+	{
+		std::fprintf(stderr, "argless fuzz: %d tokens parsed in %lld ns, limit %lld ns (%lld ns/token)\n", argc - 1, best, limit, best / std::max(argc - 1, 1));
+		std::abort();
+	}
+	return parsed;
+}
+
+inline std::vector<std::string> split(const std::uint8_t* data, std::size_t size)
+{
+	if (size < 2)
+		return {};
+
+	std::vector<std::string> tokens(1);
+	for (std::size_t i = 1; i < size; ++i)
+	{
+		if (data[i] == '\n' || data[i] == '\0')
+			tokens.emplace_back();
+		else
+			tokens.back() += static_cast<char>(data[i]);
+	}
+	return tokens;
+}
+
+// parses the input under its app, returns whether the parse succeeded
+inline bool run(const std::uint8_t* data, std::size_t size)
+{
+	if (!size)
+		return true;
+
+	auto tokens = split(data, size);
+	std::vector<const char*> argv = { "fuzz" };
+	for (auto& token : tokens)
+		argv.push_back(token.c_str());
+	int argc = static_cast<int>(argv.size());
+
+	switch (data[0] % 4)
+	{
+		case 0: return check<tuple_app>(argc, argv.data());
+		case 1: return check<variant_app>(argc, argv.data());
+		case 2: return check<fallback_app>(argc, argv.data());
+		default: return check<flags_app>(argc, argv.data());
+	}
+}
+
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size)
+{
+	fuzz::run(data, size);
+	return 0;
+}
+
+#if !defined(ARGLESS_FUZZ_LIBFUZZER)
+
+namespace fuzz {
+
+using input = std::vector<std::uint8_t>;
+
+// inverse of split, except for a single empty token which joins to no tokens
+inline input join(std::uint8_t app, const std::vector<std::string>& tokens)
+{
+	input data = { app };
+	for (std::size_t i = 0; i < tokens.size(); ++i)
+	{
+		data.insert(data.end(), tokens[i].begin(), tokens[i].end());
+		if (i + 1 < tokens.size())
+			data.push_back('\n');
+	}
+	return data;
+}
+
+// token level mutations, runs of repeated tokens are what makes backtracking parsers slow
+inline input mutate(const std::vector<input>& corpus, std::mt19937_64& random)
+{
+	static const char* dictionary[] = { "--t", "--u", "--n", "--v", "--w", "--d", "--i", "--l", "--e", "--even", "--x",
+		"--color", "--no-color", "--colour", "-c", "--list", "--ids", "--verbose", "-v", "--speed", "--jobs", "-j", "--json", "--yaml", "-y",
+		"--col", "--li", "--verb", "build", "run", "fast", "--target", "--times", "--", "-", "-vy", "--jobs=4", "--x=1",
+		"0", "1", "-1", "2.5", "nan", "true", "false", "alpha", "gamma", "slow", "auto", "text", "4294967296", "" };
+
+	auto pick = [&](std::size_t n) { return static_cast<std::size_t>(random() % n); };
+	const input& base = corpus[pick(corpus.size())];
+	std::uint8_t app = base.empty() ? '0' : base[0];
+	auto tokens = split(base.data(), base.size());
+
+	for (std::size_t step = 0, steps = 1 + pick(4); step < steps; ++step)
+	{
+		std::size_t at = tokens.empty() ? 0 : pick(tokens.size());
+		switch (pick(7))
+		{
+			case 0:
+				tokens.insert(tokens.begin() + static_cast<std::ptrdiff_t>(at), dictionary[pick(std::size(dictionary))]);
+				break;
+			case 1:
+				if (!tokens.empty())
+					tokens.insert(tokens.begin() + static_cast<std::ptrdiff_t>(at), 1 + pick(256), tokens[at]);
+				break;
+			case 2:
+				if (!tokens.empty())
+				{
+					std::size_t count = 1 + pick(std::min<std::size_t>(8, tokens.size() - at));
+					std::vector<std::string> run(tokens.begin() + static_cast<std::ptrdiff_t>(at), tokens.begin() + static_cast<std::ptrdiff_t>(at + count));
+					for (std::size_t i = 0, n = 1 + pick(64); i < n; ++i)
+						tokens.insert(tokens.end(), run.begin(), run.end());
+				}
+				break;
+			case 3:
+				if (!tokens.empty())
+					tokens.erase(tokens.begin() + static_cast<std::ptrdiff_t>(at));
+				break;
+			case 4:
+				if (!tokens.empty() && !tokens[at].empty())
+					tokens[at][pick(tokens[at].size())] ^= static_cast<char>(1 << pick(7));
+				break;
+			case 5:
+			{
+				auto& from = corpus[pick(corpus.size())];
+				auto other = split(from.data(), from.size());
+				tokens.insert(tokens.end(), other.begin(), other.end());
+				break;
+			}
+			case 6:
+				app = static_cast<std::uint8_t>('0' + pick(4));
+				break;
+		}
+	}
+	return join(app, tokens);
+}
+
+inline bool read(const std::filesystem::path& path, std::vector<input>& corpus)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+		return false;
+	corpus.emplace_back(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	return true;
+}
+
+// the input that is about to run, written out by the abort handler for the failing input to be replayed
+inline const input* current = nullptr;
+
+extern "C" inline void on_abort(int)
+{
+	if (current)
+	{
+		if (std::FILE* file = std::fopen("fuzz-failure", "wb"))
+		{
+			std::fwrite(current->data(), 1, current->size(), file);
+			std::fclose(file);
+			std::fprintf(stderr, "argless fuzz: input written to fuzz-failure\n");
+		}
+	}
+	std::_Exit(EXIT_FAILURE);
+}
+
+}
+
+int main(int argc, const char** argv)
+{
+	std::vector<fuzz::input> corpus;
+	std::vector<std::string> names;
+	std::size_t runs = 0;
+	std::uint64_t seed = 1;
+	bool valid = false;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		if (!std::strcmp(argv[i], "--runs") && i + 1 < argc)
+			runs = std::strtoull(argv[++i], nullptr, 10);
+		else if (!std::strcmp(argv[i], "--seed") && i + 1 < argc)
+			seed = std::strtoull(argv[++i], nullptr, 10);
+		else if (!std::strcmp(argv[i], "--valid"))
+			valid = true;
+		else if (std::filesystem::is_directory(argv[i]))
+		{
+			std::vector<std::filesystem::path> files;
+			for (auto& entry : std::filesystem::directory_iterator(argv[i]))
+			{
+				if (entry.is_regular_file())
+					files.push_back(entry.path());
+			}
+			std::sort(files.begin(), files.end());
+			for (auto& file : files)
+			{
+				if (fuzz::read(file, corpus))
+					names.push_back(file.string());
+			}
+		}
+		else if (fuzz::read(argv[i], corpus))
+			names.push_back(argv[i]);
+		else
+		{
+			std::fprintf(stderr, "cannot read %s\n", argv[i]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	if (corpus.empty())
+	{
+		std::fprintf(stderr, "usage: %s [--runs n] [--seed s] [--valid] <corpus files or directories>\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	std::signal(SIGABRT, fuzz::on_abort);
+
+	// --valid: every corpus input has to parse without error under its app, a seed which does not never reaches its composite
+	std::size_t invalid = 0;
+	for (std::size_t i = 0; i < corpus.size(); ++i)
+	{
+		fuzz::current = &corpus[i];
+		if (!fuzz::run(corpus[i].data(), corpus[i].size()) && valid)
+		{
+			std::fprintf(stderr, "argless fuzz: %s does not parse under its app\n", names[i].c_str());
+			++invalid;
+		}
+	}
+	if (invalid)
+		return EXIT_FAILURE;
+	std::printf("%zu corpus inputs passed\n", corpus.size());
+
+	std::mt19937_64 random(seed);
+	for (std::size_t i = 0; i < runs; ++i)
+	{
+		auto data = fuzz::mutate(corpus, random);
+		fuzz::current = &data;
+		fuzz::run(data.data(), data.size());
+	}
+	if (runs)
+		std::printf("%zu mutated inputs passed (seed %llu)\n", runs, static_cast<unsigned long long>(seed));
+
+	return EXIT_SUCCESS;
+}
+
+#endif
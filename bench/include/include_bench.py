@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+import argparse
+import os
+import statistics
+import subprocess
+import sys
+import time
+
+# generates the single header with each feature profile (tools/generate_header.py --features/--strip)
+# and reports its size, preprocessing and parsing time of a bare include and compile time of a tiny tool
+
+profiles = [
+    ("full", []),
+    ("full, stripped", ["--strip", "tetter.hpp"]),
+    ("minimal", ["--features", "minimal"]),
+    ("minimal, stripped", ["--features", "minimal", "--strip", "tetter.hpp"]),
+]
+
+include_only = "#include <argless.hpp>\n"
+
+tiny_tool = """#include <argless.hpp>
+
+enum class mode { fast, slow };
+
+template <>
+struct argless::enum_refl<mode>
+{
+	using values = argless::enum_values<argless::enum_value<"fast", mode::fast>, argless::enum_value<"slow", mode::slow>>;
+};
+
+using app = argless::app<"Tiny", argless::nodesc, argless::accumulate<const char*>,
+	argless::arg<void, "--verbose", argless::nodesc, "-v">,
+	argless::arg<int, "--jobs", argless::nodesc, "-j">,
+	argless::arg<std::string, "--name">,
+	argless::arg<mode, "--mode">
+>;
+
+int main(int argc, const char** argv)
+{
+	auto result = app::parse(argc, argv);
+	return static_cast<bool>(result.error()) + result.get<"--jobs">().value_or(0);
+}
+"""
+
+def timed(command, repeat):
+    times = []
+    for _ in range(repeat):
+        start = time.perf_counter()
+        result = subprocess.run(command, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE)
+        times.append(time.perf_counter() - start)
+        if result.returncode != 0:
+            print(result.stderr.decode(errors="replace"), file=sys.stderr)
+            return None
+    return statistics.median(times)
+
+def main():
+    parser = argparse.ArgumentParser(description="argless include-time benchmark of single header profiles")
+    parser.add_argument("--compiler", default=os.environ.get("CXX", "c++"))
+    parser.add_argument("--generator", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "tools", "generate_header.py"))
+    parser.add_argument("--header", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "include", "argless.hpp"))
+    parser.add_argument("--include", action="append", default=[], help="include directory of the generator, argless sources and tetter (repeatable)")
+    parser.add_argument("--out", default="include_bench")
+    parser.add_argument("--repeat", type=int, default=5, help="runs per measurement, median is reported")
+    parser.add_argument("--flags", default="-std=c++20 -O0", help="compiler flags")
+    args = parser.parse_args()
+
+    out = os.path.abspath(args.out)
+    os.makedirs(out, exist_ok=True)
+    for name, source in (("include_only", include_only), ("tiny_tool", tiny_tool)):
+        with open(os.path.join(out, name + ".cpp"), "w") as f:
+            f.write(source)
+
+    print(f"{'profile':<20} {'lines':>7} {'KiB':>7} {'-E s':>7} {'parse s':>8} {'tool s':>7}")
+    for profile, options in profiles:
+        directory = os.path.join(out, profile.replace(", ", "_"))
+        os.makedirs(directory, exist_ok=True)
+        header = os.path.join(directory, "argless.hpp")
+        command = [sys.executable, args.generator, os.path.abspath(args.header), "-o", header] + [f"-I={os.path.abspath(d)}" for d in args.include] + options
+        if subprocess.run(command, stderr=subprocess.DEVNULL).returncode != 0:
+            print(f"{profile:<20} generator failed")
+            return 1
+        with open(header) as f:
+            text = f.read()
+
+        flags = [args.compiler] + args.flags.split() + [f"-I{directory}"]
+        preprocess = timed(flags + ["-E", os.path.join(out, "include_only.cpp")], args.repeat)
+        parse = timed(flags + ["-fsyntax-only", os.path.join(out, "include_only.cpp")], args.repeat)
+        tool = timed(flags + ["-c", os.path.join(out, "tiny_tool.cpp"), "-o", os.path.join(directory, "tiny_tool.o")], args.repeat)
+        if None in (preprocess, parse, tool):
+            print(f"{profile:<20} failed")
+            return 1
+        print(f"{profile:<20} {text.count(chr(10)):>7} {len(text) / 1024:>7.1f} {preprocess:>7.3f} {parse:>8.3f} {tool:>7.3f}", flush=True)
+
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+import argparse
+import os
+import struct
+import subprocess
+import sys
+
+# links generated programs with and without ARGLESS_COMPACT_CORE and reports .text size,
+# growth per added arg (one app) and per added app (apps of a few args, like one per subtool)
+
+def generate(apps, count):
+    lines = ["#include <argless.hpp>", ""]
+    for a in range(apps):
+        args = []
+        for i in range(count):
+            kind = ("void", "int", "const char*")[(a + i) % 3]
+            args.append(f"\targless::arg<{kind}, \"--app{a}-arg{i}\">")
+        lines.append(f"using app{a} = argless::app<\"App{a}\", argless::nodesc, argless::accumulate<const char*>" + "".join(",\n" + arg for arg in args) + ">;")
+        lines.append("")
+    lines.append("int main(int argc, const char** argv)")
+    lines.append("{")
+    lines.append("\tint sum = 0;")
+    for a in range(apps):
+        lines.append(f"\tsum += static_cast<bool>(app{a}::parse(argc, argv).error());")
+    lines.append("\treturn sum;")
+    lines.append("}")
+    return "\n".join(lines) + "\n"
+
+# size of .text of an ELF file, whole file size for other formats
+def text_size(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != b"\x7fELF" or data[4] != 2:
+        return len(data)
+    endian = "<" if data[5] == 1 else ">"
+    shoff, = struct.unpack_from(endian + "Q", data, 0x28)
+    shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", data, 0x3A)
+    def section(i):
+        name, _, _, _, offset, size = struct.unpack_from(endian + "IIQQQQ", data, shoff + i * shentsize)
+        return name, offset, size
+    _, strtab, _ = section(shstrndx)
+    for i in range(shnum):
+        name, _, size = section(i)
+        end = data.index(b"\0", strtab + name)
+        if data[strtab + name:end] == b".text":
+            return size
+    return 0
+
+def build(compiler, flags, out, name, source, compact):
+    path = os.path.join(out, name + (".compact" if compact else ""))
+    with open(path + ".cpp", "w") as f:
+        f.write(source)
+    command = [compiler] + flags + (["-DARGLESS_COMPACT_CORE"] if compact else []) + [path + ".cpp", "-o", path]
+    result = subprocess.run(command, stderr=subprocess.PIPE)
+    if result.returncode != 0:
+        print(result.stderr.decode(errors="replace"), file=sys.stderr)
+        return None
+    return text_size(path)
+
+def report(title, unit, points, compiler, flags, out):
+    print(f"\n{title}")
+    print(f"{unit:>6} {'inline':>10} {'/' + unit:>8} {'compact':>10} {'/' + unit:>8}")
+    last = None
+    for x, apps, count in points:
+        source = generate(apps, count)
+        sizes = [build(compiler, flags, out, f"{unit}_{x}", source, compact) for compact in (False, True)]
+        if None in sizes:
+            return False
+        if last is None:
+            print(f"{x:>6} {sizes[0]:>10} {'':>8} {sizes[1]:>10} {'':>8}")
+        else:
+            growth = [(s - l) / (x - last[0]) for s, l in zip(sizes, last[1])]
+            print(f"{x:>6} {sizes[0]:>10} {growth[0]:>8.0f} {sizes[1]:>10} {growth[1]:>8.0f}", flush=True)
+        last = (x, sizes)
+    return True
+
+def main():
+    parser = argparse.ArgumentParser(description="argless binary size benchmark")
+    parser.add_argument("--compiler", default=os.environ.get("CXX", "c++"))
+    parser.add_argument("--include", action="append", default=[], help="include directory (repeatable)")
+    parser.add_argument("--out", default="size_bench")
+    parser.add_argument("--args", default="1,2,4,8,16,32,64", help="arg counts of the single app")
+    parser.add_argument("--apps", default="1,2,4,8,16,30", help="app counts")
+    parser.add_argument("--app-args", type=int, default=5, help="args per app when counting apps")
+    parser.add_argument("--flags", default="-std=c++20 -Os", help="compiler flags")
+    args = parser.parse_args()
+
+    os.makedirs(args.out, exist_ok=True)
+    flags = args.flags.split() + [f"-I{d}" for d in args.include]
+
+    print(".text bytes, inline core vs ARGLESS_COMPACT_CORE")
+    if not report("one app", "args", [(n, 1, n) for n in map(int, args.args.split(","))], args.compiler, flags, args.out):
+        return 1
+    if not report(f"apps of {args.app_args} args", "apps", [(n, n, args.app_args) for n in map(int, args.apps.split(","))], args.compiler, flags, args.out):
+        return 1
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
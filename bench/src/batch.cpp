@@ -0,0 +1,61 @@
+#include "bench.hpp"
+
+#include <thread>
+#include <string>
+#include <vector>
+#include <argless.hpp>
+
+using app = argless::app<"BatchBench", argless::nodesc, argless::accumulate<const char*>,
+		argless::arg<void, "--verbose", argless::nodesc, "-v">,
+		argless::arg<unsigned int, "--threads", argless::nodesc, "-j">,
+		argless::arg<float, "--ratio">,
+		argless::arg<const char*, "--output", argless::nodesc, "-o">,
+		argless::arg<std::vector<int>, "--ids">
+	>;
+
+int main(int argc, const char** argv)
+{
+	std::size_t line_count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 500000;
+
+	std::vector<std::string> numbers;
+	for (std::size_t i = 0; i < 1000; ++i)
+		numbers.push_back(std::to_string(i));
+
+	std::vector<std::vector<const char*>> lines(line_count);
+	for (std::size_t i = 0; i < line_count; ++i)
+	{
+		auto& line = lines[i];
+		line = { "job", "-j", numbers[i % 64].c_str(), "--output", "out.bin", "--ids" };
+		for (std::size_t j = 0; j < i % 8; ++j)
+			line.push_back(numbers[(i + j) % 1000].c_str());
+		if (i % 3 == 0) line.push_back("-v");
+		if (i % 1000 == 999) line.push_back("--ratio"), line.push_back("not-a-number");
+	}
+
+	std::size_t max_threads = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : std::thread::hardware_concurrency();
+	if (!max_threads) max_threads = 1;
+
+	std::printf("%zu command lines, up to %zu threads\n", line_count, max_threads);
+
+	double single = 0;
+	for (std::size_t threads = 1; ; threads = threads * 2 > max_threads && threads != max_threads ? max_threads : threads * 2)
+	{
+		std::size_t errors = 0;
+		auto s = bench::run(1, [&](std::size_t) {
+			auto results = app::validate_batch(lines, threads);
+			for (auto& error : results)
+				errors += static_cast<bool>(error);
+		});
+		if (threads == 1) single = s.m_ns;
+
+		std::printf("threads %3zu: %10.2f ms %8.1f ns/line  speedup %5.2fx  errors %zu\n",
+			threads, s.m_ns / 1e6, s.m_ns / static_cast<double>(line_count), single / s.m_ns, errors);
+
+		if (threads == max_threads) break;
+	}
+
+	auto results = app::parse_batch(lines, max_threads);
+	bench::keep(results);
+
+	return EXIT_SUCCESS;
+}
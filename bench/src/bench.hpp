@@ -0,0 +1,200 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// NOTE: include only in one translation unit per benchmark executable (replaces global operator new/delete)
+
+namespace bench {
+
+inline std::atomic<std::size_t> allocations = 0;
+
+// hardware counters of the calling thread (user space only), with ARGLESS_BENCH_COUNTERS=1 in the environment,
+// events the kernel or the machine does not provide (containers, VMs, perf_event_paranoid) are reported as unavailable
+
+enum counter { instructions, branch_misses, cache_misses, counter_count };
+
+inline constexpr const char* counter_names[counter_count] = { "instr", "br-miss", "cache-miss" };
+
+struct counter_group
+{
+	int m_fds[counter_count] = { -1, -1, -1 };
+	int m_leader = -1;
+
+	counter_group()
+	{
+		const char* enabled = std::getenv("ARGLESS_BENCH_COUNTERS");
+		if (!enabled || !*enabled || !std::strcmp(enabled, "0"))
+			return;
+
+#if defined(__linux__)
+		constexpr unsigned long long configs[counter_count] = { PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_BRANCH_MISSES, PERF_COUNT_HW_CACHE_MISSES };
+		int error = 0;
+		for (int c = 0; c < counter_count; ++c)
+		{
+			perf_event_attr attr = {};
+			attr.size = sizeof(attr);
+			attr.type = PERF_TYPE_HARDWARE;
+			attr.config = configs[c];
+			attr.disabled = m_leader == -1;
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+			m_fds[c] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, m_leader, 0));
+			if (m_fds[c] == -1)
+				error = errno;
+			else if (m_leader == -1)
+				m_leader = m_fds[c];
+		}
+
+		if (m_leader == -1)
+			std::printf("(counters unavailable: perf_event_open: %s, see /proc/sys/kernel/perf_event_paranoid)\n", std::strerror(error));
+		for (int c = 0; c < counter_count; ++c)
+		{
+			if (m_leader != -1 && m_fds[c] == -1)
+				std::printf("(counter %s unavailable)\n", counter_names[c]);
+		}
+#else
+		std::printf("(counters unavailable: perf_event_open is linux only)\n");
+#endif
+	}
+
+	~counter_group()
+	{
+#if defined(__linux__)
+		for (int fd : m_fds)
+		{
+			if (fd != -1)
+				close(fd);
+		}
+#endif
+	}
+
+	inline bool enabled() const { return m_leader != -1; }
+
+	inline void start()
+	{
+#if defined(__linux__)
+		ioctl(m_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+		ioctl(m_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+	}
+
+	// counts since start(), scaled up when the kernel multiplexed the counters, -1 for unavailable ones
+	inline void stop(double (&counts)[counter_count])
+	{
+#if defined(__linux__)
+		ioctl(m_leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+		for (int c = 0; c < counter_count; ++c)
+		{
+			unsigned long long values[3] = {};
+			counts[c] = -1;
+			if (m_fds[c] != -1 && read(m_fds[c], values, sizeof(values)) == sizeof(values) && values[2])
+				counts[c] = static_cast<double>(values[0]) * static_cast<double>(values[1]) / static_cast<double>(values[2]);
+		}
+#else
+		for (double& count : counts)
+			count = -1;
+#endif
+	}
+};
+
+inline counter_group& counters()
+{
+	static counter_group group;
+	return group;
+}
+
+struct sample
+{
+	double m_ns = 0;
+	double m_allocs = 0;
+	double m_counters[counter_count] = { -1, -1, -1 };
+};
+
+template <typename f_t>
+inline sample run(std::size_t iterations, f_t&& f)
+{
+	auto& group = counters();
+	if (group.enabled())
+		group.start();
+
+	std::size_t allocs = allocations;
+	auto start = std::chrono::steady_clock::now();
+	for (std::size_t i = 0; i < iterations; ++i)
+		f(i);
+	auto end = std::chrono::steady_clock::now();
+
+	sample result;
+	if (group.enabled())
+	{
+		group.stop(result.m_counters);
+		for (double& count : result.m_counters)
+		{
+			if (count >= 0)
+				count /= static_cast<double>(iterations);
+		}
+	}
+	result.m_ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / static_cast<double>(iterations);
+	result.m_allocs = static_cast<double>(allocations - allocs) / static_cast<double>(iterations);
+	return result;
+}
+
+inline void report_counters(const sample& s, double n, const char* unit)
+{
+	if (!counters().enabled())
+		return;
+	for (int c = 0; c < counter_count; ++c)
+	{
+		if (s.m_counters[c] >= 0)
+			std::printf(" %10.2f %s/%s", s.m_counters[c] / n, counter_names[c], unit);
+		else
+			std::printf(" %10s %s/%s", "-", counter_names[c], unit);
+	}
+}
+
+inline void report(const char* name, const sample& s)
+{
+	std::printf("%-40s %12.1f ns/op %10.2f allocs/op", name, s.m_ns, s.m_allocs);
+	report_counters(s, 1, "op");
+	std::printf("\n");
+}
+
+inline void report(const char* name, const sample& s, std::size_t tokens)
+{
+	auto n = static_cast<double>(tokens);
+	std::printf("%-40s %12.1f ns/op %10.2f ns/token %10.2f allocs/token", name, s.m_ns, s.m_ns / n, s.m_allocs / n);
+	report_counters(s, n, "token");
+	std::printf("\n");
+}
+
+template <typename t>
+inline void keep(const t& value)
+{
+	asm volatile("" : : "g"(&value) : "memory");
+}
+
+}
+
+void* operator new(std::size_t size)
+{
+	bench::allocations.fetch_add(1, std::memory_order_relaxed);
+	if (void* p = std::malloc(size ? size : 1))
+		return p;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
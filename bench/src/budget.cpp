@@ -0,0 +1,268 @@
+#include "bench.hpp"
+
+#include <atomic>
+#include <string>
+#include <vector>
+#define ARGLESS_STDH_ALL
+#include <argless.hpp>
+
+#if defined(__linux__)
+#include <linux/filter.h>
+#include <linux/seccomp.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+// allocation and system call budgets of canonical apps, exits with failure when one is exceeded
+
+enum class budget_enum { a, b, c };
+
+template <>
+struct argless::enum_refl<budget_enum>
+{
+	using values = argless::enum_values<
+		argless::enum_value<"alpha", budget_enum::a>,
+		argless::enum_value<"beta", budget_enum::b>,
+		argless::enum_value<"gamma", budget_enum::c>
+	>;
+};
+
+using flags_app = argless::app<"Flags", argless::nodesc, void,
+	argless::arg<void, "--verbose", argless::nodesc, "-v">,
+	argless::arg<bool, "--color">,
+	argless::arg<unsigned int, "--threads", argless::nodesc, "-j">,
+	argless::arg<double, "--ratio">,
+	argless::arg<char, "--sep">,
+	argless::arg<const char*, "--output", argless::nodesc, "-o">,
+	argless::arg<budget_enum, "--mode">,
+	argless::arg<argless::option<"fast", "slow", "auto">, "--speed">,
+	argless::arg<std::array<int, 2>, "--size">,
+	argless::arg<std::optional<int>, "--level">
+>;
+
+using positional_app = argless::app<"Positional", argless::nodesc, argless::accumulate<const char*>,
+	argless::arg<void, "--verbose", argless::nodesc, "-v">
+>;
+
+using path_app = argless::app<"Paths", argless::nodesc, argless::accumulate<std::filesystem::path>,
+	argless::arg<void, "--verbose", argless::nodesc, "-v">
+>;
+
+using string_app = argless::app<"String", argless::nodesc, void,
+	argless::arg<std::string, "--name">
+>;
+
+// path validation touches the file system, the control case of the system call check
+using exists_app = argless::app<"Exists", argless::nodesc, void,
+	argless::arg<argless::validate<[](const std::filesystem::path& p) { return std::filesystem::exists(p); }>, "--input">
+>;
+
+struct command_line
+{
+	std::vector<std::string> m_strings;
+	std::vector<const char*> m_argv;
+
+	command_line(std::vector<std::string> strings) : m_strings(std::move(strings))
+	{
+		for (auto& string : m_strings)
+			m_argv.push_back(string.c_str());
+	}
+
+	inline int argc() const { return static_cast<int>(m_argv.size()); }
+	inline const char** argv() { return m_argv.data(); }
+};
+
+inline command_line positional_line(const char* prefix, std::size_t count)
+{
+	std::vector<std::string> strings = { "budget", "-v" };
+	for (std::size_t i = 0; i < count; ++i)
+		strings.push_back(prefix + std::to_string(i) + ".txt");
+	return command_line(std::move(strings));
+}
+
+// allocations of one call after a warm-up call
+template <typename f_t>
+inline std::size_t allocations_of(f_t&& f)
+{
+	f();
+	std::size_t before = bench::allocations;
+	f();
+	return bench::allocations - before;
+}
+
+// system calls of one call after a warm-up call, counted in a forked child where every system call
+// but exit_group and rt_sigreturn traps into a SIGSYS handler instead of running, -1 when not supported
+#if defined(__linux__) && defined(SECCOMP_RET_TRAP)
+struct syscall_record
+{
+	std::atomic<long> m_count;
+	long m_first;
+};
+
+inline syscall_record* record = nullptr;
+
+extern "C" inline void on_sigsys(int, siginfo_t* info, void*)
+{
+	if (record->m_count.fetch_add(1, std::memory_order_relaxed) == 0)
+		record->m_first = info->si_syscall;
+}
+#endif
+
+template <typename f_t>
+inline long syscalls_of(f_t&& f, long* first)
+{
+#if defined(__linux__) && defined(SECCOMP_RET_TRAP)
+	void* memory = mmap(nullptr, sizeof(syscall_record), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (memory == MAP_FAILED)
+		return -1;
+	record = new (memory) syscall_record{ {0}, -1 };
+
+	std::fflush(nullptr);
+	pid_t pid = fork();
+	if (pid == 0)
+	{
+		f();
+
+		struct sigaction action = {};
+		action.sa_sigaction = on_sigsys;
+		action.sa_flags = SA_SIGINFO;
+		sigemptyset(&action.sa_mask);
+
+		sock_filter filter[] = {
+			BPF_STMT(BPF_LD | BPF_W | BPF_ABS, offsetof(seccomp_data, nr)),
+			BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, SYS_rt_sigreturn, 2, 0),
+			BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, SYS_exit_group, 1, 0),
+			BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_TRAP),
+			BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_ALLOW),
+		};
+		sock_fprog program = { static_cast<unsigned short>(std::size(filter)), filter };
+
+		if (sigaction(SIGSYS, &action, nullptr) != 0 || prctl(PR_SET_NO_NEW_PRIVS, 1, 0, 0, 0) != 0 ||
+			prctl(PR_SET_SECCOMP, SECCOMP_MODE_FILTER, &program) != 0)
+			_exit(2);
+
+		f();
+		_exit(0);
+	}
+
+	int status = 0;
+	if (pid < 0 || waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+	{
+		munmap(memory, sizeof(syscall_record));
+		return -1;
+	}
+
+	long count = record->m_count;
+	*first = record->m_first;
+	munmap(memory, sizeof(syscall_record));
+	return count;
+#else
+	(void)f;
+	(void)first;
+	return -1;
+#endif
+}
+
+inline int failures = 0;
+
+// terms the budgets are built from, each one is a guarantee of the design rather than a count measured on one standard library
+
+// app::parse reserves the token table once, parser_context::parse_into reuses it
+constexpr std::size_t token_table = 1;
+
+// a result container is only grown by push_back, counted for the smallest growth factor in use (1.5, MSVC),
+// libstdc++ and libc++ double and stay below it, parse_into keeps the capacity and does not grow again
+constexpr std::size_t growth(std::size_t items)
+{
+	std::size_t capacity = 0, allocations = 0;
+	for (std::size_t size = 0; size < items; ++size)
+		if (size == capacity)
+		{
+			capacity += capacity / 2 ? capacity / 2 : 1;
+			++allocations;
+		}
+	return allocations;
+}
+
+// std::filesystem::path owns its string (longer than the small string buffer) and libstdc++ also allocates its component list
+constexpr std::size_t per_path = 2;
+
+// a std::string value longer than the small string buffer is one allocation, it is not kept between parse_into calls
+constexpr std::size_t per_long_string = 1;
+
+inline void check_allocations(const char* name, std::size_t allocations, std::size_t budget)
+{
+	bool pass = allocations <= budget;
+	failures += !pass;
+	std::printf("%-58s %6zu allocs  (<= %4zu)  %s\n", name, allocations, budget, pass ? "ok" : "FAIL");
+}
+
+// expect_none: the contract is no system calls, otherwise (control case) some must be seen
+inline void check_syscalls(const char* name, long syscalls, long first, bool expect_none)
+{
+	if (syscalls < 0)
+	{
+		std::printf("%-58s %6s           (seccomp not available)  skipped\n", name, "-");
+		return;
+	}
+	bool pass = expect_none ? syscalls == 0 : syscalls > 0;
+	failures += !pass;
+	std::printf("%-58s %6ld syscalls (%s)", name, syscalls, expect_none ? "<=    0" : "control > 0");
+	if (syscalls)
+		std::printf(" first nr %ld", first);
+	std::printf("  %s\n", pass ? "ok" : "FAIL");
+}
+
+template <typename app>
+inline void check_app(const char* name, command_line& line, std::size_t parse_budget, std::size_t reuse_budget, bool syscall_free = true)
+{
+	std::string title = name;
+
+	auto parse = [&]() {
+		auto result = app::parse(line.argc(), line.argv());
+		bench::keep(result);
+	};
+	check_allocations((title + ", app::parse").c_str(), allocations_of(parse), parse_budget);
+
+	argless::parser_context<app, char> context;
+	argless::result<app, char> result;
+	auto reuse = [&]() {
+		context.parse_into(result, line.argc(), line.argv());
+		bench::keep(result);
+	};
+	check_allocations((title + ", parser_context::parse_into").c_str(), allocations_of(reuse), reuse_budget);
+
+	long first = -1;
+	long syscalls = syscalls_of(parse, &first);
+	check_syscalls((title + ", app::parse").c_str(), syscalls, first, syscall_free);
+}
+
+int main()
+{
+	command_line flags({ "budget", "-v", "--color", "false", "-j", "8", "--ratio", "0.25", "--sep", ",", "-o", "out.bin",
+		"--mode", "gamma", "--speed", "auto", "--size", "640", "480", "--level", "3" });
+	command_line short_positional = positional_line("in", 100);
+	command_line long_positional = positional_line("/usr/local/share/argless/input/file_", 100);
+	command_line string({ "budget", "--name", "a value longer than the small string buffer" });
+	command_line exists({ "budget", "--input", "/" });
+
+	std::printf("allocation and system call budgets\n");
+	// budgets are (app::parse, parser_context::parse_into)
+	// scalar, enum, option, std::array and std::optional values never allocate
+	check_app<flags_app>("flags only (10 args)", flags, token_table, 0);
+	// the accumulated const char* point into argv
+	check_app<positional_app>("100 positional const char*", short_positional, token_table + growth(100), 0);
+	// every path is rebuilt, only the vector's capacity is kept
+	check_app<path_app>("100 positional paths", long_positional, token_table + growth(100) + 100 * per_path, 100 * per_path);
+	check_app<string_app>("long std::string value", string, token_table + per_long_string, per_long_string);
+	// the system call control, its parse allocates like flags only
+	check_app<exists_app>("validated path (control)", exists, token_table, 0, false);
+
+	if (failures)
+		std::printf("\n%d budget(s) exceeded\n", failures);
+	return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
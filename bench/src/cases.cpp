@@ -0,0 +1,166 @@
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#define ARGLESS_STDH_ALL
+#include <argless.hpp>
+
+// behaviour cases of token forms which are easy to get wrong, exits with failure when one does not hold
+
+enum class case_level { debug, info };
+
+template <>
+struct argless::enum_refl<case_level>
+{
+	using values = argless::enum_values<
+		argless::enum_value<"debug", case_level::debug>,
+		argless::enum_value<"info", case_level::info>
+	>;
+};
+
+using complete_app = argless::app<"Complete", argless::nodesc, void,
+	argless::arg<void, "--verbose", argless::nodesc, "-v">,
+	argless::arg<case_level, "--level", argless::nodesc, "-l">,
+	argless::arg<int, "-j">
+>;
+
+using abbreviation_app = argless::app<"Abbreviation", argless::nodesc, void,
+	argless::abbreviations,
+	argless::arg<void, "--verbose">,
+	argless::arg<int, "--level">,
+	argless::arg<int, "--thread">,
+	argless::arg<int, "--thread-count">
+>;
+
+using marker_app = argless::app<"Marker", argless::nodesc, argless::accumulate<const char*>,
+	argless::arg<void, "-a">,
+	argless::arg<int, "--name">
+>;
+
+using negatable_app = argless::app<"Negatable", argless::nodesc, void,
+	argless::arg<argless::negatable<>, "--color", argless::nodesc, "--colour">
+>;
+
+using list_app = argless::app<"List", argless::nodesc, std::vector<const char*>,
+	argless::arg<void, "-a">,
+	argless::arg<const char*, "-o">,
+	argless::page<"build", argless::nodesc, std::vector<const char*>,
+		argless::arg<void, "-v">
+	>
+>;
+
+static int failures = 0;
+
+static void check(bool pass, const std::string& what)
+{
+	std::printf("%-58s %s\n", what.c_str(), pass ? "ok" : "FAIL");
+	failures += !pass;
+}
+
+static std::string joined(const std::vector<std::string>& words)
+{
+	std::string text;
+	for (auto& word : words)
+		text += (text.empty() ? "" : " ") + word;
+	return text;
+}
+
+// words after "__complete", the last one is under the cursor
+template <typename app>
+static void check_complete(std::vector<std::string> words, const std::vector<std::string>& expected)
+{
+	std::vector<const char*> argv = { "prog", "__complete" };
+	for (auto& word : words)
+		argv.push_back(word.c_str());
+
+	std::vector<std::string> candidates;
+	argless::complete<app>(static_cast<int>(argv.size()), argv.data(), [&](const char* candidate) { candidates.emplace_back(candidate); });
+	check(candidates == expected, "complete [" + joined(words) + "] -> [" + joined(candidates) + "]");
+}
+
+template <typename app>
+static typename argless::result<app, char> parse(std::vector<const char*> argv)
+{
+	argv.insert(argv.begin(), "prog");
+	return app::parse(static_cast<int>(argv.size()), argv.data());
+}
+
+int main()
+{
+	std::printf("completion\n");
+	check_complete<complete_app>({ "--level=" }, { "--level=debug", "--level=info" });
+	check_complete<complete_app>({ "--level=d" }, { "--level=debug" });
+	check_complete<complete_app>({ "-l=i" }, { "-l=info" });
+	check_complete<complete_app>({ "-vl", "" }, { "debug", "info" });
+	check_complete<complete_app>({ "-vld" }, { "-vldebug" });
+	check_complete<complete_app>({ "-vj8", "--le" }, { "--level" });
+	check_complete<complete_app>({ "--verbose=" }, {});
+	check_complete<complete_app>({ "--", "-" }, {});
+	check_complete<list_app>({ "-o", "build", "-" }, { "-a", "-o" });
+	check_complete<list_app>({ "build", "-" }, { "-v" });
+
+
+	std::printf("\nabbreviations\n");
+	{
+		auto result = parse<abbreviation_app>({ "--lev=3" });
+		check(!result.error() && result.get<"--level">() == 3, "--lev=3 selects --level");
+	}
+	{
+		auto result = parse<abbreviation_app>({ "--thread=8", "--thread-c=2" });
+		check(!result.error() && result.get<"--thread">() == 8 && result.get<"--thread-count">() == 2, "--thread=8 (whole name) --thread-c=2");
+	}
+	{
+		auto result = parse<abbreviation_app>({ "--thr=1" });
+		check(result.error().type() == argless::result_error_type::ambiguous_arg, "--thr=1 is ambiguous");
+	}
+	{
+		auto result = parse<abbreviation_app>({ "--verb=1" });
+		check(result.error().type() == argless::result_error_type::stray_value, "--verb=1 (flag takes no value) is a stray value");
+	}
+
+	std::printf("\nend of options\n");
+	{
+		auto result = parse<marker_app>({ "--name", "--", "x" });
+		auto& error = result.error();
+		check(error.type() == argless::result_error_type::invalid_arg_value && !error.suggestion(), "--name -- x: value is missing, -- is not the value");
+	}
+	{
+		auto result = parse<marker_app>({ "--name", "-b" });
+		auto suggestion = result.error().suggestion();
+		check(suggestion && std::string(suggestion) == "-a", "--name -b: -b is the invalid value (did you mean -a)");
+	}
+
+	{
+		auto result = parse<list_app>({ "a", "b", "--", "c" });
+		auto& values = result.get<>();
+		check(!result.error() && values && *values == std::vector<const char*>{ "a", "b", "c" }, "a b -- c: values after -- continue the list before it");
+	}
+	{
+		auto result = parse<list_app>({ "build", "src1", "--", "-v" });
+		auto& values = result.get<"build">().get<>();
+		check(!result.error() && !result.get<"build", "-v">() && values && values->size() == 2 && std::string((*values)[1]) == "-v",
+			"build src1 -- -v: page list continues, -v is a value");
+	}
+
+	std::printf("\npath\n");
+
+	{
+		const char* argv[] = { "build", "a" };
+		auto result = list_app::parse(2, argv);
+		auto& values = result.get<>();
+		check(!result.error() && !result.get<"build">() && values && values->size() == 1, "argv[0] named like a page is the path");
+	}
+
+	std::printf("\nhelp\n");
+
+	{
+		auto text = argless::help_arg_text<negatable_app>("--color");
+		check(!text.empty() && argless::help_arg_text<negatable_app>("--no-color") == text && argless::help_arg_text<negatable_app>("--no-colour") == text,
+			"--no-color and --no-colour: help of --color");
+		check(argless::help_arg_text<negatable_app>("--no-colo").empty(), "--no-colo: no help");
+	}
+
+	if (failures)
+		std::printf("\n%d case(s) failed\n", failures);
+	return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,48 @@
+#include "bench.hpp"
+
+#include <vector>
+#include <argless.hpp>
+
+using app = argless::app<"ContextBench", argless::nodesc, argless::accumulate<const char*>,
+		argless::arg<void, "--verbose", argless::nodesc, "-v">,
+		argless::arg<unsigned int, "--threads", argless::nodesc, "-j">,
+		argless::arg<float, "--ratio">,
+		argless::arg<const char*, "--output", argless::nodesc, "-o">,
+		argless::arg<argless::accumulate<int>, "--id">
+	>;
+
+int main()
+{
+	const char* lines[][10] = {
+		{ "tool", "-v", "-j", "8", "in.txt" },
+		{ "tool", "--output", "out.bin", "--id", "1", "--id", "2", "a", "b" },
+		{ "tool", "--ratio", "0.5", "x", "y", "z" },
+		{ "tool", "-o", "o", "-j", "16", "--verbose", "--id", "7", "file" },
+	};
+	constexpr int counts[] = { 5, 9, 6, 9 };
+	constexpr std::size_t iterations = 200000;
+
+	std::printf("%zu iterations over %zu command lines\n", iterations, std::size(lines));
+
+	auto fresh = bench::run(iterations, [&](std::size_t i) {
+		auto result = app::parse(counts[i % 4], lines[i % 4]);
+		bench::keep(result);
+	});
+	bench::report("app::parse", fresh);
+
+	argless::parser_context<app, char> context;
+	auto reused_token_table = bench::run(iterations, [&](std::size_t i) {
+		auto result = context.parse(counts[i % 4], lines[i % 4]);
+		bench::keep(result);
+	});
+	bench::report("parser_context::parse", reused_token_table);
+
+	argless::result<app, char> result;
+	auto reused = bench::run(iterations, [&](std::size_t i) {
+		context.parse_into(result, counts[i % 4], lines[i % 4]);
+		bench::keep(result);
+	});
+	bench::report("parser_context::parse_into", reused);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,176 @@
+#include "bench.hpp"
+
+#include <forward_list>
+#define ARGLESS_STDH_ALL
+#include <argless.hpp>
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#ifndef BENCH_MAX_FLAGS
+#define BENCH_MAX_FLAGS 100
+#endif
+
+// synthetic apps: "--f0".."--fN" int args, noname collects the rest
+
+template <std::size_t i>
+constexpr inline std::size_t digit_count = i < 10 ? 1 : 1 + digit_count<i / 10>;
+
+template <std::size_t i>
+constexpr inline auto flag_name = [](){
+	argless::core::str<char, 4 + digit_count<i>> name;
+	name.m_buffer[0] = '-';
+	name.m_buffer[1] = '-';
+	name.m_buffer[2] = 'f';
+	for (std::size_t d = 0, v = i; d < digit_count<i>; ++d, v /= 10)
+		name.m_buffer[3 + digit_count<i> - 1 - d] = static_cast<char>('0' + v % 10);
+	return name;
+}();
+
+template <typename seq>
+struct synthetic;
+
+template <std::size_t... i>
+struct synthetic<std::index_sequence<i...>>
+{
+	using app = argless::app<"Synthetic", argless::nodesc, argless::accumulate<const char*>,
+		argless::arg<int, flag_name<i>>...
+	>;
+};
+
+template <std::size_t n>
+using synthetic_app = typename synthetic<std::make_index_sequence<n>>::app;
+
+// argv of token_count tokens, every other pair is "--fK value", the rest are noname values
+struct argv_storage
+{
+	std::vector<std::string> m_strings;
+	std::vector<const char*> m_argv;
+
+	argv_storage(std::size_t flag_count, std::size_t token_count)
+	{
+		m_strings.reserve(token_count + 1);
+		m_strings.push_back("bench");
+		for (std::size_t t = 0; t + 1 < token_count; t += 2)
+		{
+			if (t % 4 == 0)
+			{
+				m_strings.push_back("--f" + std::to_string((t / 4) % flag_count));
+				m_strings.push_back(std::to_string(t));
+			}
+			else
+			{
+				m_strings.push_back("in" + std::to_string(t));
+				m_strings.push_back("in" + std::to_string(t + 1));
+			}
+		}
+		while (m_strings.size() < token_count + 1)
+			m_strings.push_back("tail");
+
+		for (auto& string : m_strings)
+			m_argv.push_back(string.c_str());
+	}
+
+	inline int argc() const { return static_cast<int>(m_argv.size()); }
+	inline const char** argv() { return m_argv.data(); }
+};
+
+// repeat count keeps every case around the same total number of tokens
+inline std::size_t iterations_for(std::size_t tokens)
+{
+	std::size_t iterations = 2000000 / (tokens + 1);
+	return iterations ? iterations : 1;
+}
+
+template <typename app>
+inline void bench_app(const char* name, int argc, const char** argv)
+{
+	std::size_t tokens = static_cast<std::size_t>(argc) - 1;
+	auto sample = bench::run(iterations_for(tokens), [&](std::size_t) {
+		auto result = app::parse(argc, argv);
+		bench::keep(result);
+	});
+	bench::report(name, sample, tokens ? tokens : 1);
+}
+
+template <std::size_t flag_count>
+inline void bench_classification()
+{
+	std::printf("\n%zu flags\n", flag_count);
+	for (std::size_t tokens = 1; tokens <= 1000000; tokens *= 10)
+	{
+		argv_storage storage(flag_count, tokens);
+		std::string name = std::to_string(flag_count) + " flags, " + std::to_string(tokens) + " tokens";
+		bench_app<synthetic_app<flag_count>>(name.c_str(), storage.argc(), storage.argv());
+	}
+}
+
+// one app per parser, argv is "--v" followed by its value tokens
+
+enum class bench_enum { a, b, c };
+
+template <>
+struct argless::enum_refl<bench_enum>
+{
+	using values = argless::enum_values<
+		argless::enum_value<"alpha", bench_enum::a>,
+		argless::enum_value<"beta", bench_enum::b>,
+		argless::enum_value<"gamma", bench_enum::c>
+	>;
+};
+
+template <typename t>
+using value_app = argless::app<"Value", argless::nodesc, void, argless::arg<t, "--v">>;
+
+template <typename t, typename... values>
+inline void bench_parser(const char* name, values... value)
+{
+	const char* argv[] = { "bench", "--v", value... };
+	bench_app<value_app<t>>(name, static_cast<int>(std::size(argv)), argv);
+}
+
+using nested_tuple = std::tuple<std::tuple<float, std::variant<std::list<std::array<int, 2>>, std::list<int>>, int>, int>;
+using wide_variant = std::variant<bool, int, float, std::array<int, 3>, std::string>;
+using deep_variant = std::variant<bool, std::variant<int, std::variant<float, std::variant<std::tuple<int, int>, std::string>>>>;
+
+int main()
+{
+	std::printf("classification and conversion (ns/token, allocs/token)\n");
+	bench_classification<10>();
+	bench_classification<BENCH_MAX_FLAGS>();
+#if BENCH_MAX_FLAGS < 1000
+	std::printf("\n(1000 flags: configure with -DARGLESS_BENCH_MAX_FLAGS=1000)\n");
+#endif
+
+	std::printf("\nparsers (ns/token, allocs/token)\n");
+	bench_parser<void>("void");
+	bench_parser<bool>("bool", "true");
+	bench_parser<int>("int", "-123456");
+	bench_parser<unsigned long long>("unsigned long long", "18446744073709551615");
+	bench_parser<float>("float", "3.14159");
+	bench_parser<double>("double", "-2.5e10");
+	bench_parser<char>("char", "x");
+	bench_parser<const char*>("const char*", "text");
+	bench_parser<std::string>("std::string", "some longer text value for sso");
+	bench_parser<std::string_view>("std::string_view", "text");
+	bench_parser<std::filesystem::path>("std::filesystem::path", "/usr/local/share/argless");
+	bench_parser<bench_enum>("enum", "gamma");
+	bench_parser<std::array<int, 4>>("std::array<int, 4>", "1", "2", "3", "4");
+	bench_parser<std::vector<int>>("std::vector<int> x8", "1", "2", "3", "4", "5", "6", "7", "8");
+	bench_parser<std::list<int>>("std::list<int> x8", "1", "2", "3", "4", "5", "6", "7", "8");
+	bench_parser<std::deque<int>>("std::deque<int> x8", "1", "2", "3", "4", "5", "6", "7", "8");
+	bench_parser<std::forward_list<int>>("std::forward_list<int> x8", "1", "2", "3", "4", "5", "6", "7", "8");
+	bench_parser<std::optional<int>>("std::optional<int>", "7");
+	bench_parser<std::tuple<int, float, std::string>>("std::tuple<int, float, string>", "1", "2.5", "s");
+	bench_parser<argless::option<"fast", "slow", "auto">>("argless::option", "auto");
+
+	std::printf("\npathological composites (ns/token, allocs/token)\n");
+	bench_parser<nested_tuple>("nested tuple/variant (list<int>)", "1.5", "1", "2", "3", "4", "5", "6", "7");
+	bench_parser<wide_variant>("variant, last alternative", "not-a-number");
+	bench_parser<deep_variant>("4-deep variant, last alternative", "text");
+	bench_parser<std::vector<std::tuple<int, std::variant<int, std::string>>>>("vector<tuple<int, variant>> x4",
+		"1", "a", "2", "b", "3", "c", "4", "d");
+
+	return EXIT_SUCCESS;
+}
@@ -25,8 +25,8 @@ struct argless::enum_refl<ExampleEnum>
 };
 
 using app = argless::app<"ExampleArglessApp", argless::nodesc, argless::accumulate<std::filesystem::path>,
-		argless::arg<std::optional<argless::force<const char*>>, "--help", "this is example description", "-h", "?", "-help">,
-		argless::arg<void, "--version", argless::nodesc, "-V", "-version">,
+		argless::arg<argless::terminal<std::optional<argless::force<const char*>>>, "--help", "this is example description", "-h", "?", "-help">,
+		argless::arg<argless::terminal<void>, "--version", argless::nodesc, "-V", "-version">,
 		argless::arg<void, "--flag">,
 		argless::arg<unsigned int, "--positive-int">,
 		argless::arg<float, "--float">,
@@ -68,7 +68,7 @@ int main(int argc, const char** argv)
 {
 	auto result = app::parse(argc, argv);
 
-	if (auto& err = result.error(); err && !result.get<"--help">())
+	if (auto& err = result.error())
 	{
 		std::cerr << argless::help_error<app>(err, argc, argv) << std::endl;
 		return EXIT_FAILURE;
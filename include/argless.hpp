@@ -2,5 +2,8 @@
 #include "argless/core.hpp"
 
 #include "argless/argless.hpp"
+#include "argless/compact.hpp"
 #include "argless/helper.hpp"
+#include "argless/completion.hpp"
 #include "argless/parsers.hpp"
+#include "argless/batch.hpp"
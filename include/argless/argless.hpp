@@ -5,6 +5,11 @@
 
 #include <optional>
 #include <vector>
+#include <tuple>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <iterator>
 #include <type_traits>
 
 _ARGLESS_CORE_BEGIN
@@ -21,12 +26,98 @@ concept containerable = std::is_default_constructible_v<t> && (std::is_void_v<t>
 		requires (t c) { ++c; }
 	));
 
+// in place heap sort, constexpr and without <algorithm>
+template <typename t, typename less_t>
+inline constexpr void heap_sort(t* values, std::size_t size, less_t&& less)
+{
+	auto sift = [&](std::size_t root, std::size_t end) {
+		while (2 * root + 1 < end)
+		{
+			std::size_t child = 2 * root + 1;
+			if (child + 1 < end && less(values[child], values[child + 1])) ++child;
+			if (!less(values[root], values[child])) return;
+			std::swap(values[root], values[child]);
+			root = child;
+		}
+	};
+
+	for (std::size_t i = size / 2; i-- > 0;)
+		sift(i, size);
+	for (std::size_t end = size; end-- > 1;)
+	{
+		std::swap(values[0], values[end]);
+		sift(0, end);
+	}
+}
+
+// names copied as char32_t (so any char types compare) and sorted once,
+// collision checks and name lookups are O(n log n) constexpr work instead of pairwise template instantiations
+template <std::size_t count, std::size_t chars>
+struct name_set
+{
+	struct entry
+	{
+		std::size_t m_offset = 0;
+		std::size_t m_index = 0;
+	};
+
+	template <typename str_t>
+	inline constexpr void add(const str_t& name, std::size_t index = 0)
+	{
+		m_entries[m_size++] = { m_used, index };
+		for (std::size_t i = 0; i < name.size() && name.m_buffer[i]; ++i)
+			m_chars[m_used++] = static_cast<char32_t>(name.m_buffer[i]);
+		m_chars[m_used++] = 0;
+	}
+
+	inline constexpr const char32_t* at(const entry& e) const { return m_chars + e.m_offset; }
+
+	inline constexpr void sort()
+	{
+		heap_sort(m_entries, m_size, [&](const entry& l, const entry& r) { return scmp(at(l), at(r)) < 0; });
+	}
+
+	// sorted set only
+	inline constexpr bool unique() const
+	{
+		for (std::size_t i = 1; i < m_size; ++i)
+			if (!scmp(at(m_entries[i - 1]), at(m_entries[i])))
+				return false;
+		return true;
+	}
+
+	// sorted set only, index passed to add or not_found
+	template <typename char_t>
+	inline constexpr std::size_t find(const char_t* name, std::size_t not_found) const
+	{
+		std::size_t first = 0, last = m_size;
+		while (first < last)
+		{
+			std::size_t mid = first + (last - first) / 2;
+			int cmp = scmp(at(m_entries[mid]), name);
+			if (!cmp) return m_entries[mid].m_index;
+			if (cmp < 0) first = mid + 1;
+			else last = mid;
+		}
+		return not_found;
+	}
+
+	entry m_entries[count + 1] = {};
+	char32_t m_chars[chars + 1] = {};
+	std::size_t m_size = 0;
+	std::size_t m_used = 0;
+};
+
+template <typename... values>
+constexpr inline bool names_unique = [](){
+	name_set<sizeof...(values), (values::value.size() + ... + 0)> set;
+	(set.add(values::value), ...);
+	set.sort();
+	return set.unique();
+}();
+
 template <typename... values>
-concept no_name_collision = tetter<values...>::template value_l<[]<typename t, std::size_t i>() {
-		return tetter<values...>::template pop_front_n<i + 1>::template value_l<[]<typename st, std::size_t>() {
-			return _ARGLESS_CORE seq(t::value.data(), st::value.data()); 
-		}>::any;
-	}>::none;
+concept no_name_collision = names_unique<values...>;
 
 template <bool derivable, typename t>
 struct _derive_impl;
@@ -99,6 +190,28 @@ template <_ARGLESS_CORE parsable t, auto value_or_lambda>
 		std::is_convertible_v<decltype(value_or_lambda), typename _ARGLESS_CORE parser<t>::type>
 struct default_value { static constexpr inline auto value = value_or_lambda; };
 
+// what a repeated arg does, error reports ambiguous_arg_value
+enum class repeat_policy
+{
+	error,
+	first_wins,
+	last_wins,
+	merge, // appends values of container args
+};
+
+// arg<repeat<t, policy>, ...> is an arg of t, occurrences which do not win are skipped without building their value
+template <_ARGLESS_CORE parsable t, repeat_policy policy>
+struct repeat {};
+
+// arg<terminal<t>, ...> (--help, --version) stops parsing, when present only it and its value are parsed
+template <_ARGLESS_CORE parsable t>
+struct terminal {};
+
+// flag which also registers "--no-name" for its name and aliases starting with "--", result is unset/true/false
+template <_ARGLESS_CORE parsable t = void>
+	requires std::is_void_v<t> || std::is_same_v<t, bool>
+struct negatable {};
+
 
 template <_ARGLESS_CORE parsable t, _ARGLESS_CORE str new_name>
 struct rename : public _ARGLESS_CORE derive<t>
@@ -170,6 +283,26 @@ private:
 	std::size_t m_index = 0;
 };
 
+// arg groups, checked after the whole app/page is parsed
+
+// at most one of names
+template <_ARGLESS_CORE str... names>
+	requires (sizeof...(names) > 0) && _ARGLESS_CORE no_name_collision<std::integral_constant<decltype(names), names>...>
+struct exclusive {};
+
+// at least one of names
+template <_ARGLESS_CORE str... names>
+	requires (sizeof...(names) > 0) && _ARGLESS_CORE no_name_collision<std::integral_constant<decltype(names), names>...>
+struct at_least_one {};
+
+// none or all of names
+template <_ARGLESS_CORE str... names>
+	requires (sizeof...(names) > 0) && _ARGLESS_CORE no_name_collision<std::integral_constant<decltype(names), names>...>
+struct all_or_none {};
+
+// app/page setting: unambiguous prefix of a "--" name/alias selects its arg (--verb -> --verbose)
+struct abbreviations {};
+
 _ARGLESS_END
 
 
@@ -206,6 +339,12 @@ struct result_cast_impl<default_value<t, v>>
 	using type = std::optional<t>;
 };
 
+template <typename t>
+struct result_cast_impl<negatable<t>>
+{
+	using type = std::optional<bool>;
+};
+
 // result-type for non-parse types
 template <typename t>
 using result_cast = typename result_cast_impl<t>::type;
@@ -239,6 +378,12 @@ struct parse_cast_impl<default_value<t, v>>
 	using type = t;
 };
 
+template <typename t>
+struct parse_cast_impl<negatable<t>>
+{
+	using type = t;
+};
+
 // parsable-type for non-parse types
 template <typename t>
 using parse_cast = typename parse_cast_impl<t>::type;
@@ -285,6 +430,18 @@ struct result_insert<void>
 	}
 };
 
+template <typename t>
+struct result_insert<negatable<t>>
+{
+	// "--no-name" inserts false
+	static inline constexpr bool call(std::optional<bool>& result, bool value = true)
+	{
+		if (result) return false;
+		result = value;
+		return true;
+	}
+};
+
 template <typename c>
 struct result_insert<accumulate<void, c>>
 {
@@ -299,6 +456,43 @@ struct result_insert<accumulate<void, c>>
 	}
 };
 
+template <typename t>
+struct result_merge
+{
+	static inline constexpr bool call(result_cast<t>& result, parse_cast<t>&& value)
+	{
+		if (!result)
+			result = std::move(value);
+		else
+			result->insert(result->end(), std::make_move_iterator(value.begin()), std::make_move_iterator(value.end()));
+		return true;
+	}
+};
+
+// noname arg values after "--" are appended to the ones before it, for containers of values (not strings)
+template <typename t>
+concept continued_noname = requires (result_cast<t> result, parse_cast<t> value) { result->insert(result->end(), value.begin(), value.end()); } &&
+	!requires { typename parse_cast<t>::traits_type; };
+
+template <typename t>
+struct result_reset
+{
+	static inline constexpr void call(result_cast<t>& result) { result = result_cast<t>(); }
+};
+
+template <typename t, typename c>
+struct result_reset<accumulate<t, c>>
+{
+	// keeps container capacity for reused results
+	static inline constexpr void call(accumulate<t, c>& result)
+	{
+		if constexpr (requires (c r) { r.clear(); })
+			result.clear();
+		else
+			result = c();
+	}
+};
+
 template <typename t>
 struct result_get
 {
@@ -325,6 +519,195 @@ struct result_get<default_value<t, v>>
 	}
 };
 
+_ARGLESS_CORE_END
+_ARGLESS_BEGIN
+
+template <_ARGLESS_CORE str, _ARGLESS_CORE str, _ARGLESS_CORE parsable, typename... args_>
+struct page;
+
+_ARGLESS_END
+_ARGLESS_CORE_BEGIN
+
+template <typename t>
+struct is_page : public std::false_type {};
+
+template <_ARGLESS_CORE str name, _ARGLESS_CORE str desc, _ARGLESS_CORE parsable noname_arg_type, typename... args_>
+struct is_page<page<name, desc, noname_arg_type, args_...>> : public std::true_type {};
+
+template <typename t>
+concept page_t = is_page<t>::value;
+
+template <typename t>
+struct is_group : public std::false_type {};
+
+template <_ARGLESS_CORE str... names>
+struct is_group<exclusive<names...>> : public std::true_type {};
+
+template <_ARGLESS_CORE str... names>
+struct is_group<at_least_one<names...>> : public std::true_type {};
+
+template <_ARGLESS_CORE str... names>
+struct is_group<all_or_none<names...>> : public std::true_type {};
+
+template <typename t>
+concept group_t = is_group<t>::value;
+
+template <typename t>
+struct is_setting : public std::false_type {};
+
+template <>
+struct is_setting<abbreviations> : public std::true_type {};
+
+template <typename t>
+concept setting_t = is_setting<t>::value;
+
+template <typename t>
+struct is_required : public std::false_type {};
+
+template <typename t>
+struct is_required<required<t>> : public std::true_type {};
+
+template <typename t>
+struct is_default_value : public std::false_type {};
+
+template <typename t, auto v>
+struct is_default_value<default_value<t, v>> : public std::true_type {};
+
+template <typename t>
+struct attribute_cast_impl
+{
+	using type = t;
+	static constexpr inline auto policy = repeat_policy::error;
+	static constexpr inline bool terminal = false;
+};
+
+template <typename t, repeat_policy policy_>
+struct attribute_cast_impl<repeat<t, policy_>> : public attribute_cast_impl<t>
+{
+	static constexpr inline auto policy = policy_;
+};
+
+template <typename t>
+struct attribute_cast_impl<terminal<t>> : public attribute_cast_impl<t>
+{
+	static constexpr inline bool terminal = true;
+};
+
+// arg type without attributes (repeat, terminal)
+template <typename t>
+using attribute_cast = typename attribute_cast_impl<t>::type;
+
+template <typename t>
+struct is_negatable : public std::false_type {};
+
+template <typename t>
+struct is_negatable<negatable<t>> : public std::true_type {};
+
+template <_ARGLESS_CORE str name>
+constexpr inline bool is_long_name = name.size() > 3 && name.m_buffer[0] == '-' && name.m_buffer[1] == '-';
+
+// "--name" -> "--no-name"
+template <_ARGLESS_CORE str name>
+	requires is_long_name<name>
+inline consteval auto negated_name()
+{
+	using char_t = typename decltype(name)::char_t;
+	str<char_t, name.size() - 2> rest;
+	for (std::size_t i = 0; i < rest.size(); ++i)
+		rest.m_buffer[i] = name.m_buffer[i + 2];
+	return str_from<char_t, "--no-">() + rest;
+}
+
+// names, aliases and generated "--no-" names of an app/page element
+template <typename t>
+struct element_names
+{
+	static constexpr inline std::size_t count = 0;
+	static constexpr inline std::size_t chars = 0;
+
+	template <typename set_t>
+	static inline constexpr void add(set_t&, std::size_t, bool) {}
+};
+
+template <typename t>
+	requires requires { t::name; t::aliases; }
+struct element_names<t>
+{
+	static constexpr inline bool negatable = [](){
+		if constexpr (page_t<t>) return false;
+		else return is_negatable<typename t::type>::value;
+	}();
+
+	template <auto name>
+	static constexpr inline std::size_t negated_chars = negatable && is_long_name<name> ? name.size() + 3 : 0;
+
+	static constexpr inline std::size_t alias_count = tetter_from<decltype(t::aliases)>::count;
+
+	static constexpr inline std::size_t count = [](){
+		std::size_t count = 1 + alias_count;
+		if constexpr (negatable)
+		{
+			count += is_long_name<t::name>;
+			tetter_sequence<alias_count>::invoke([&]<std::size_t a>() { count += is_long_name<std::get<a>(t::aliases)>; });
+		}
+		return count;
+	}();
+
+	static constexpr inline std::size_t chars = [](){
+		std::size_t chars = t::name.size() + negated_chars<t::name>;
+		tetter_sequence<alias_count>::invoke([&]<std::size_t a>() { chars += std::get<a>(t::aliases).size() + negated_chars<std::get<a>(t::aliases)>; });
+		return chars;
+	}();
+
+	template <typename set_t>
+	static inline constexpr void add(set_t& set, std::size_t index, bool negated)
+	{
+		set.add(t::name, index);
+		tetter_sequence<alias_count>::invoke([&]<std::size_t a>() { set.add(std::get<a>(t::aliases), index); });
+
+		if constexpr (negatable)
+			if (negated)
+			{
+				if constexpr (is_long_name<t::name>)
+					set.add(negated_name<t::name>(), index);
+				tetter_sequence<alias_count>::invoke([&]<std::size_t a>() {
+					if constexpr (is_long_name<std::get<a>(t::aliases)>)
+						set.add(negated_name<std::get<a>(t::aliases)>(), index);
+				});
+			}
+	}
+};
+
+template <typename... args>
+constexpr inline bool names_and_aliases_unique = [](){
+	name_set<(element_names<args>::count + ... + 0), (element_names<args>::chars + ... + 0)> set;
+	(element_names<args>::add(set, 0, true), ...);
+	set.sort();
+	return set.unique();
+}();
+
+template <typename... args>
+concept no_name_or_alias_collision = names_and_aliases_unique<args...>;
+
+// sorted names and aliases of app/page args (tetter) to their index, shared by every result.get<>
+template <typename values>
+constexpr inline auto name_index = [](){
+	constexpr auto sizes = [](){
+		std::size_t count = 0, chars = 0;
+		values::invoke([&]<typename t, std::size_t>() { count += 1 + tetter_from<decltype(t::aliases)>::count; chars += element_names<t>::chars; });
+		return std::make_pair(count, chars);
+	}();
+
+	name_set<sizes.first, sizes.second> set;
+	values::invoke([&]<typename t, std::size_t i>() { element_names<t>::add(set, i, false); });
+	set.sort();
+	return set;
+}();
+
+// looked up once per app and name, not per result type or get overload
+template <typename values, _ARGLESS_CORE str name>
+constexpr inline std::size_t arg_index = name_index<values>.find(name.data(), values::count);
+
 template <_ARGLESS_CORE str... names>
 struct result_find;
 
@@ -334,26 +717,27 @@ struct result_find<name, names...>
 	static inline auto&& call(auto&& self)
 	{
 		using This = std::remove_cvref_t<decltype(self)>;
-		using Values = decltype([](){
-				if constexpr (requires { typename This::app; })
-					return typename This::app::args{};
-				else
-					return typename This::__todo_for_page{};
-			}());
-		static constexpr auto arg_index = [](){
-			return Values::template find_l<[]<typename t>() {
-				return _ARGLESS_CORE seq(t::name.data(), name.data()) ||
-					tetter_sequence<tetter_from<decltype(t::aliases)>::count>::template value_l<[]<std::size_t i>() {
-						return _ARGLESS_CORE seq(std::get<i>(t::aliases).data(), name.data());
-					}>::any; 
-			}>::index;
-		}();
-		static_assert(arg_index != Values::count, "missing arg name");
-
-		if constexpr (sizeof...(names))
-			return _ARGLESS_CORE result_get<typename Values::template get<arg_index>::type>::call(std::get<arg_index>(std::forward<decltype(self)>(self).m_values)).template get<names...>();
+		using Values = typename This::app::args;
+		constexpr auto index = arg_index<Values, name>;
+		if constexpr (index == Values::count)
+			static_assert(index != Values::count, "missing arg name");
 		else
-			return _ARGLESS_CORE result_get<typename Values::template get<arg_index>::type>::call(std::get<arg_index>(std::forward<decltype(self)>(self).m_values).m_value);
+		{
+			// element type of the value tuple, without walking the arg list
+			using arg = std::remove_cvref_t<decltype(std::get<index>(self.m_values))>;
+			if constexpr (_ARGLESS_CORE page_t<arg>)
+			{
+				if constexpr (sizeof...(names))
+					return std::get<index>(std::forward<decltype(self)>(self).m_values).template get<names...>();
+				else
+					return std::get<index>(std::forward<decltype(self)>(self).m_values);
+			}
+			else
+			{
+				static_assert(!sizeof...(names), "only pages have nested arg names");
+				return _ARGLESS_CORE result_get<typename arg::type>::call(std::get<index>(std::forward<decltype(self)>(self).m_values).m_value);
+			}
+		}
 	}
 };
 
@@ -367,31 +751,6 @@ struct result_find<>
 	}
 };
 
-template <typename t>
-struct is_required : public std::false_type {};
-
-template <typename t>
-struct is_required<required<t>> : public std::true_type {};
-
-template <typename t>
-struct is_default_value : public std::false_type {};
-
-template <typename t, auto v>
-struct is_default_value<default_value<t, v>> : public std::true_type {};
-
-template <typename... args>
-concept no_name_or_alias_collision = (tetter<args...>::template map_l<
-		[]<typename t, std::size_t>() -> typename tetter<std::integral_constant<decltype(t::name), t::name>>::template join<
-			typename tetter_sequence<tetter_from<decltype(t::aliases)>::count>::template map_l<
-				[]<std::size_t i>() -> std::integral_constant<decltype(std::get<i>(t::aliases)), std::get<i>(t::aliases)> {}
-			>
-		> {}
-	>::concat_a::template value_l<[]<typename t, std::size_t i, typename... ts>() {
-		return tetter<ts...>::template pop_front_n<i + 1>::template value_l<[]<typename st>() {
-			return _ARGLESS_CORE seq(t::value.data(), st::value.data()); 
-		}>::any;
-	}>::none);
-
 _ARGLESS_CORE_END
 _ARGLESS_BEGIN
 
@@ -413,10 +772,27 @@ concept arg_t = is_arg<t>::value;
 template <typename t>
 concept opt_arg_t = is_arg<t>::value || std::is_same<t, void>::value;
 
+// element of app/page arg list
+template <typename t>
+concept app_arg_t = arg_t<t> || page_t<t> || group_t<t> || setting_t<t>;
+
+template <typename app_like>
+struct parse_impl;
+
+// type-erased parse core (ARGLESS_COMPACT_CORE), see compact.hpp
+template <typename char_t>
+struct compact_core;
+
+template <typename char_t>
+struct compact_state;
+
+template <typename app_like, typename char_t>
+struct compact_tables;
+
 _ARGLESS_CORE_END
 _ARGLESS_BEGIN
 
-template <_ARGLESS_CORE str, _ARGLESS_CORE str, _ARGLESS_CORE parsable, _ARGLESS_CORE arg_t... args_>
+template <_ARGLESS_CORE str, _ARGLESS_CORE str, _ARGLESS_CORE parsable, _ARGLESS_CORE app_arg_t... args_>
 	requires _ARGLESS_CORE no_name_or_alias_collision<args_...>
 struct app;
 
@@ -426,13 +802,28 @@ _ARGLESS_CORE_BEGIN
 template <typename t>
 struct is_app : public std::false_type {};
 
-template <_ARGLESS_CORE str name, _ARGLESS_CORE str desc, _ARGLESS_CORE parsable noname_arg_type, _ARGLESS_CORE arg_t... args_>
+template <_ARGLESS_CORE str name, _ARGLESS_CORE str desc, _ARGLESS_CORE parsable noname_arg_type, _ARGLESS_CORE app_arg_t... args_>
 struct is_app<app<name, desc, noname_arg_type, args_...>> : public std::true_type {};
 
 template <typename t>
 concept app_t = is_app<t>::value;
 
 _ARGLESS_CORE_END
+_ARGLESS_BEGIN
+
+template <_ARGLESS_CORE app_t, typename>
+struct parser_context;
+
+_ARGLESS_END
+_ARGLESS_CORE_BEGIN
+
+template <typename app, typename lines_t>
+struct batch
+{
+	static_assert(false, "batch parsing is not available (include <thread> before argless or define ARGLESS_STDH_THREAD) or lines_t is not a range of argv spans");
+};
+
+_ARGLESS_CORE_END
 
 
 
@@ -451,8 +842,17 @@ constexpr inline auto nodesc = _ARGLESS_CORE str("");
 template <_ARGLESS_CORE parsable type_, _ARGLESS_CORE str name_, _ARGLESS_CORE str desc_ = nodesc, _ARGLESS_CORE str... aliases_>
 struct arg
 {
+	static_assert(!_ARGLESS_CORE is_negatable<_ARGLESS_CORE attribute_cast<type_>>::value || _ARGLESS_CORE is_long_name<name_> || (_ARGLESS_CORE is_long_name<aliases_> || ...),
+		"negatable arg needs a name or alias starting with \"--\"");
+	static_assert(_ARGLESS_CORE attribute_cast_impl<type_>::policy != repeat_policy::merge ||
+		requires (_ARGLESS_CORE result_cast<_ARGLESS_CORE attribute_cast<type_>> result, _ARGLESS_CORE parse_cast<_ARGLESS_CORE attribute_cast<type_>> value) {
+			result->insert(result->end(), value.begin(), value.end());
+		}, "repeat_policy::merge needs a container arg type");
+
 public:
-	using type = type_;
+	using type = _ARGLESS_CORE attribute_cast<type_>;
+	static constexpr auto repeat = _ARGLESS_CORE attribute_cast_impl<type_>::policy;
+	static constexpr auto terminal = _ARGLESS_CORE attribute_cast_impl<type_>::terminal;
 	static constexpr auto name = name_;
 	static constexpr auto desc = desc_;
 	static constexpr auto aliases = std::make_tuple(aliases_...);
@@ -461,9 +861,8 @@ private:
 	template <_ARGLESS_CORE str...>
 	friend struct _ARGLESS_CORE result_find;
 
-	template <_ARGLESS_CORE str, _ARGLESS_CORE str, _ARGLESS_CORE parsable, _ARGLESS_CORE arg_t... args_>
-		requires _ARGLESS_CORE no_name_or_alias_collision<args_...>
-	friend struct app;
+	template <typename>
+	friend struct _ARGLESS_CORE parse_impl;
 
 	_ARGLESS_CORE result_cast<type> m_value;
 };
@@ -477,6 +876,10 @@ enum class result_error_type
 	ambiguous_arg_value,
 	invalid_arg_value,
 	missing_arg,
+	conflicting_args,
+	missing_group_arg,
+	incomplete_group,
+	ambiguous_arg,
 };
 
 template <typename char_t>
@@ -496,10 +899,15 @@ public:
 	inline constexpr std::size_t where() const { return m_index; }
 	inline constexpr const char_t* what_type() const { return m_expected_type; }
 
+	// closest arg/page name to the unrecognized token (stray_value, invalid_arg_value), computed on call
+	inline const char_t* suggestion() const { return m_suggest && m_value ? m_suggest(m_value) : nullptr; }
+
 private:
-	template <_ARGLESS_CORE str, _ARGLESS_CORE str, _ARGLESS_CORE parsable, _ARGLESS_CORE arg_t... args_>
-		requires _ARGLESS_CORE no_name_or_alias_collision<args_...>
-	friend struct app;
+	template <typename>
+	friend struct _ARGLESS_CORE parse_impl;
+
+	template <typename>
+	friend struct _ARGLESS_CORE compact_core;
 
 	result_error_type m_type = result_error_type::none; 
 
@@ -508,11 +916,16 @@ private:
 	const char_t* m_arg_type = nullptr;
 	std::size_t m_index = 0;
 	const char_t* m_expected_type = nullptr;
+
+	const char_t* m_value = nullptr;
+	const char_t* (*m_suggest)(const char_t*) = nullptr;
 };
 
-template <_ARGLESS_CORE app_t app_, typename char_t>
+template <_ARGLESS_CORE app_t app_, typename char_t, std::size_t error_capacity = 1>
 struct result
 {
+	static_assert(error_capacity > 0, "result needs room for at least one error");
+
 public:
 	using app = app_;
 
@@ -541,163 +954,1066 @@ public:
 	inline const auto&& get() const && { return _ARGLESS_CORE result_find<names...>::call(*this); }
 
 public:
-	inline const result_error<char_t>& error() const { return m_error; }
+	inline const result_error<char_t>& error() const { return m_errors[0]; }
+
+	// more than one only with app::parse_all<n>, in order of appearance
+	inline std::size_t error_count() const { return m_error_count; }
+	inline const result_error<char_t>& error(std::size_t index) const { return m_errors[index]; }
 
 private:
-	template <_ARGLESS_CORE str, _ARGLESS_CORE str, _ARGLESS_CORE parsable, _ARGLESS_CORE arg_t... args_>
-		requires _ARGLESS_CORE no_name_or_alias_collision<args_...>
-	friend struct _ARGLESS app;
+	template <typename>
+	friend struct _ARGLESS_CORE parse_impl;
 
 	template <_ARGLESS_CORE str...>
 	friend struct _ARGLESS_CORE result_find;
 
 	const char_t* m_path = nullptr;
-	result_error<char_t> m_error;
+	result_error<char_t> m_errors[error_capacity];
+	std::size_t m_error_count = 0;
 
 	_ARGLESS_CORE result_cast_noname<typename app::noname_arg_type> m_noname_value;
 	typename app::args::template cast<std::tuple> m_values;
 };
 
 
-template <_ARGLESS_CORE str name_, _ARGLESS_CORE str desc_, _ARGLESS_CORE parsable noname_arg_type_, _ARGLESS_CORE arg_t... args_>
-	requires _ARGLESS_CORE no_name_or_alias_collision<args_...>
-struct app
+template <_ARGLESS_CORE str name_, _ARGLESS_CORE str desc_, _ARGLESS_CORE parsable noname_arg_type_, typename... args_>
+struct page
 {
+	static_assert((_ARGLESS_CORE app_arg_t<args_> && ...), "page args must be argless::arg, argless::page, an arg group or a setting");
+	static_assert(_ARGLESS_CORE no_name_or_alias_collision<args_...>, "page arg names or aliases collide");
+
 public:
+	using app = page;
 	static constexpr auto name = name_;
 	static constexpr auto desc = desc_;
+	static constexpr auto aliases = std::make_tuple();
 	using noname_arg_type = noname_arg_type_;
-	using args = tetter<args_...>;
+	using args = typename tetter<args_...>::template filter_l<[]<typename t, std::size_t>() { return _ARGLESS_CORE arg_t<t> || _ARGLESS_CORE page_t<t>; }>;
+	using groups = typename tetter<args_...>::template filter_l<[]<typename t, std::size_t>() { return _ARGLESS_CORE group_t<t>; }>;
+	static constexpr inline bool abbreviations = (std::is_same_v<args_, _ARGLESS abbreviations> || ...);
 
 public:
-	template <typename char_t>
-	static result<app, char_t> parse(int argc, const char_t** argv)
-	{
-		_ARGLESS_CORE args<char_t> args = [&](){
-			std::vector<typename _ARGLESS_CORE args<char_t>::arg> _args;
-			_args.reserve(argc);
-			for (decltype(argc) i = 0; i < argc; ++i)
-				_args.emplace_back(argv[i],
-					args::invoke_pipe([&]<typename t, std::size_t t_i>(std::size_t index) {
-						if (index) return index;
-						return (_ARGLESS_CORE seq(t::name.data(), argv[i]) ||
-							tetter_sequence<tetter_from<decltype(t::aliases)>::count>::invoke_any([&]<typename, std::size_t index>() {
-								return _ARGLESS_CORE seq(std::get<index>(t::aliases).data(), argv[i]);
-							})
-						) ? t_i + 1 : 0;
-					}, 0)
-				);
-			return _args;
-		}();
-		result<app, char_t> result;
-		result.m_error.m_type = result_error_type::unknown;
+	inline constexpr operator bool() const { return m_selected; }
 
-		if (auto path = args.peak())
-			result.m_path = (args.consume(), *path);
+public:
+	template <_ARGLESS_CORE str... names>
+	inline auto& get() & { return _ARGLESS_CORE result_find<names...>::call(*this); }
 
-		while (args.m_index < args.m_limit)
-		{
-			auto& arg_index = args.m_index;
-			auto& arg = args.m_args[arg_index];
+	template <_ARGLESS_CORE str... names>
+	inline auto&& get() && { return _ARGLESS_CORE result_find<names...>::call(*this); }
 
-			auto parse = [&]<typename t, std::size_t i>() -> bool
-			{
-				using type = _ARGLESS_CORE parse_cast<t>;
-				auto insert = [&](auto&&... as) -> bool {
-					if (!_ARGLESS_CORE result_insert<t>::call(std::forward<decltype(as)>(as)...))
-					{
-						result.m_error.m_type = result_error_type::ambiguous_arg_value;
-						result.m_error.m_arg_index = arg_index;
-						if constexpr (i) result.m_error.m_arg_name = _ARGLESS_CORE static_str<_ARGLESS_CORE str_cast<char_t, args::template get<i-1>::name>()>;
-						result.m_error.m_arg_type = get_name<type, char_t>();
-						return true;
-					}
-					return false;
-				};
+	template <_ARGLESS_CORE str... names>
+	inline const auto& get() const & { return _ARGLESS_CORE result_find<names...>::call(*this); }
 
-				if constexpr (std::is_void_v<type>)
+	template <_ARGLESS_CORE str... names>
+	inline const auto&& get() const && { return _ARGLESS_CORE result_find<names...>::call(*this); }
+
+private:
+	template <_ARGLESS_CORE str...>
+	friend struct _ARGLESS_CORE result_find;
+
+	template <typename>
+	friend struct _ARGLESS_CORE parse_impl;
+
+	bool m_selected = false;
+
+	_ARGLESS_CORE result_cast_noname<noname_arg_type> m_noname_value;
+	typename args::template cast<std::tuple> m_values;
+};
+
+_ARGLESS_END
+
+
+
+_ARGLESS_CORE_BEGIN
+
+template <typename t>
+struct group_impl;
+
+template <str... names_>
+struct group_impl<exclusive<names_...>>
+{
+	using names = tetter<std::integral_constant<decltype(names_), names_>...>;
+	static constexpr inline auto error = result_error_type::conflicting_args;
+	static inline constexpr bool check(std::size_t present) { return present <= 1; }
+};
+
+template <str... names_>
+struct group_impl<at_least_one<names_...>>
+{
+	using names = tetter<std::integral_constant<decltype(names_), names_>...>;
+	static constexpr inline auto error = result_error_type::missing_group_arg;
+	static inline constexpr bool check(std::size_t present) { return present >= 1; }
+};
+
+template <str... names_>
+struct group_impl<all_or_none<names_...>>
+{
+	using names = tetter<std::integral_constant<decltype(names_), names_>...>;
+	static constexpr inline auto error = result_error_type::incomplete_group;
+	static inline constexpr bool check(std::size_t present) { return !present || present == names::count; }
+};
+
+// "name, name, ..." reported as error arg name
+template <typename t, typename char_t>
+constexpr inline auto group_name = group_impl<t>::names::pop_front::invoke_pipe([]<typename n>(auto str){ return [](){ return decltype(str){}() + str_from<char_t, ", ">() + str_cast<char_t, n::value>(); }; },
+	[](){ return str_cast<char_t, group_impl<t>::names::front::value>(); })();
+
+// errors of one parse, with capacity > 1 parsing goes on after recoverable errors
+template <typename char_t, std::size_t capacity>
+struct error_sink
+{
+	result_error<char_t>* m_errors;
+	std::size_t m_count = 0;
+
+	// clean slot for the next error
+	inline result_error<char_t>& next() { return m_errors[m_count] = result_error<char_t>(); }
+
+	// false when parsing has to stop
+	inline bool commit()
+	{
+		++m_count;
+		if constexpr (capacity == 1)
+			return false;
+		else
+			return m_count < capacity;
+	}
+};
+
+template <typename char_t>
+struct name_entry
+{
+	const char_t* m_name = nullptr;
+	std::size_t m_size = 0;
+	std::size_t m_arg = 0; // index + 1
+	bool m_page = false;
+	bool m_value = false; // arg is not a flag
+	bool m_negated = false; // "--no-" form of a negatable arg
+};
+
+// fills the token table from argv (reusing its storage), "--" is only located here
+template <typename char_t>
+inline void tokenize(args<char_t>& args, int argc, const char_t** argv, const char_t** rest)
+{
+	args.m_args.clear();
+	args.m_args.reserve(argc);
+	args.m_marker = 0;
+	for (decltype(argc) i = 0; i < argc; ++i)
+	{
+		args.m_args.emplace_back(argv[i]);
+		if (!args.m_marker && i && argv[i][0] == '-' && argv[i][1] == '-' && !argv[i][2])
+			args.m_marker = i + 1;
+	}
+	args.m_index = 0;
+	args.m_limit = args.m_marker ? args.m_marker - 1 : args.m_args.size();
+	args.m_force = false;
+	args.m_rest = rest;
+	args.m_rest_count = 0;
+	args.m_terminal = 0;
+}
+
+// at "--" skips it and opens the tokens after it, which are never classified and go to noname arg (or rest),
+// a container noname arg given before it continues with them
+template <typename char_t>
+inline bool end_of_options(args<char_t>& args)
+{
+	if (!args.m_marker || args.m_index != args.m_marker - 1)
+		return false;
+	args.m_index = args.m_marker;
+	args.m_limit = args.m_args.size();
+	args.m_marker = 0;
+	return args.m_index < args.m_limit;
+}
+
+// splits unmatched "-abc", "-j8" and "--name=value" tokens in place, parts point into the token
+// or at static names (nothing is copied), returns count of inserted entries,
+// shorts holds the "-c" names by ascii c
+template <typename char_t>
+inline std::size_t split_token(args<char_t>& args, std::size_t i, const name_entry<char_t>* names, std::size_t name_count, const name_entry<char_t>* shorts)
+{
+	using arg_t = typename _ARGLESS_CORE args<char_t>::arg;
+	const char_t* value = args.m_args[i].m_value;
+	if (value[0] != '-' || !value[1])
+		return 0;
+
+	for (const char_t* it = value + 1; *it; ++it)
+		if (*it == '=')
+		{
+			for (std::size_t n = 0; n < name_count; ++n)
+			{
+				auto& entry = names[n];
+				if (entry.m_value && entry.m_size == static_cast<std::size_t>(it - value) && seq_n(entry.m_name, value, entry.m_size))
+				{
+					args.m_args[i].m_arg = entry.m_arg;
+					args.m_args.insert(args.m_args.begin() + i + 1, arg_t{ it + 1 });
+					++args.m_limit;
+					if (args.m_marker) ++args.m_marker;
+					return 1;
+				}
+			}
+			return 0;
+		}
+
+	if (value[1] == '-')
+		return 0;
+
+	// whole cluster has to be known, otherwise token stays as it is (e.g. negative numbers)
+	std::size_t count = 0;
+	const char_t* attached = nullptr;
+	for (const char_t* it = value + 1; *it; ++it)
+	{
+		if (static_cast<char32_t>(*it) >= 128 || !shorts[static_cast<char32_t>(*it)].m_arg)
+			return 0;
+		++count;
+		if (shorts[static_cast<char32_t>(*it)].m_value)
+		{
+			if (it[1]) attached = it + 1;
+			break;
+		}
+	}
+
+	std::size_t added = count - 1 + (attached ? 1 : 0);
+	if (added)
+		args.m_args.insert(args.m_args.begin() + i + 1, added, arg_t{ nullptr });
+	for (std::size_t c = 0; c < count; ++c)
+	{
+		auto& entry = shorts[static_cast<char32_t>(value[1 + c])];
+		args.m_args[i + c] = arg_t{ entry.m_name, entry.m_arg };
+	}
+	if (attached)
+		args.m_args[i + count] = arg_t{ attached };
+	args.m_limit += added;
+	if (args.m_marker) args.m_marker += added;
+	return added;
+}
+
+// bounded edit distance search over names, only lengths within the bound are scored
+template <typename char_t>
+inline const char_t* suggest_name(const char_t* value, const name_entry<char_t>* names, std::size_t name_count)
+{
+	edit_pattern<char_t> pattern(value);
+	if (!pattern.valid()) return nullptr;
+
+	std::size_t best = pattern.m_size < 4 ? 1 : pattern.m_size < 8 ? 2 : 3;
+	const char_t* result = nullptr;
+
+	for (std::size_t n = 0; n < name_count; ++n)
+	{
+		auto& entry = names[n];
+		std::size_t diff = entry.m_size > pattern.m_size ? entry.m_size - pattern.m_size : pattern.m_size - entry.m_size;
+		if (diff > best || (result && diff == best)) continue;
+
+		// a name which has to be rewritten completely is no suggestion
+		std::size_t distance = pattern.distance(entry.m_name, entry.m_size);
+		if (distance && distance < entry.m_size && distance < pattern.m_size && (distance < best || (!result && distance == best)))
+		{
+			best = distance;
+			result = entry.m_name;
+		}
+	}
+
+	return result;
+}
+
+// parse loop shared by app and page
+template <typename app_like>
+struct parse_impl
+{
+	using values = typename app_like::args;
+	using noname_arg_type = typename app_like::noname_arg_type;
+
+	using groups = typename app_like::groups;
+
+	static constexpr inline bool has_pages = values::template value_l<[]<typename t, std::size_t>() { return page_t<t>; }>::any;
+
+	// one bit per arg/page, set when its name is dispatched, so group checks dont depend on arg count
+	static constexpr inline std::size_t presence_words = groups::count ? (values::count + 63) / 64 : 0;
+	using presence_t = std::array<std::uint64_t, presence_words>;
+
+	template <typename group>
+	static constexpr inline presence_t group_mask = [](){
+		presence_t mask{};
+		group_impl<group>::names::invoke([&]<typename n, std::size_t>() {
+			constexpr auto index = values::template find_l<[]<typename t, std::size_t>() {
+				return seq(t::name.data(), n::value.data()) ||
+					tetter_sequence<tetter_from<decltype(t::aliases)>::count>::template value_l<[]<std::size_t i>() {
+						return seq(std::get<i>(t::aliases).data(), n::value.data());
+					}>::any;
+			}>::index;
+			static_assert(index != values::count, "group names an arg which is not in this app/page");
+			mask[index / 64] |= std::uint64_t(1) << (index % 64);
+		});
+		return mask;
+	}();
+
+	template <typename t>
+	static constexpr inline bool negatable_arg = [](){
+		if constexpr (page_t<t>) return false;
+		else return is_negatable<typename t::type>::value;
+	}();
+
+	static constexpr inline bool has_negatable = values::template value_l<[]<typename t, std::size_t>() { return negatable_arg<t>; }>::any;
+
+	// every arg name, alias, generated "--no-" name and page name of this app/page
+	template <typename char_t>
+	static constexpr inline auto name_table = [](){
+		constexpr std::size_t count = [](){
+			std::size_t count = 0;
+			values::invoke([&]<typename t, std::size_t>() {
+				count += 1 + tetter_from<decltype(t::aliases)>::count;
+				if constexpr (negatable_arg<t>)
+				{
+					count += is_long_name<t::name>;
+					tetter_sequence<tetter_from<decltype(t::aliases)>::count>::invoke([&]<std::size_t a>() { count += is_long_name<std::get<a>(t::aliases)>; });
+				}
+			});
+			return count;
+		}();
+
+		std::array<name_entry<char_t>, count> table{};
+		std::size_t i = 0;
+		values::invoke([&]<typename t, std::size_t t_i>() {
+			constexpr bool value = [](){
+				if constexpr (page_t<t>) return false;
+				else return !std::is_void_v<parse_cast<typename t::type>>;
+			}();
+			table[i++] = { static_str<str_cast<char_t, t::name>()>.data(), str_cast<char_t, t::name>().size() - 1, t_i + 1, page_t<t>, value };
+			tetter_sequence<tetter_from<decltype(t::aliases)>::count>::invoke([&]<std::size_t a>() {
+				table[i++] = { static_str<str_cast<char_t, std::get<a>(t::aliases)>()>.data(), str_cast<char_t, std::get<a>(t::aliases)>().size() - 1, t_i + 1, false, value };
+			});
+
+			if constexpr (negatable_arg<t>)
+			{
+				if constexpr (is_long_name<t::name>)
+					table[i++] = { static_str<str_cast<char_t, negated_name<t::name>()>()>.data(), str_cast<char_t, negated_name<t::name>()>().size() - 1, t_i + 1, false, false, true };
+				tetter_sequence<tetter_from<decltype(t::aliases)>::count>::invoke([&]<std::size_t a>() {
+					if constexpr (is_long_name<std::get<a>(t::aliases)>)
+						table[i++] = { static_str<str_cast<char_t, negated_name<std::get<a>(t::aliases)>()>()>.data(), str_cast<char_t, negated_name<std::get<a>(t::aliases)>()>().size() - 1, t_i + 1, false, false, true };
+				});
+			}
+		});
+		return table;
+	}();
+
+	template <typename t>
+	static constexpr inline repeat_policy repeat_of = [](){
+		if constexpr (page_t<t>) return repeat_policy::error;
+		else return t::repeat;
+	}();
+
+	static constexpr inline bool has_terminal = values::template value_l<[]<typename t, std::size_t>() {
+		if constexpr (page_t<t>) return false;
+		else return t::terminal;
+	}>::any;
+
+	static inline bool is_terminal(std::size_t arg)
+	{
+		constexpr auto terminals = [](){
+			std::array<bool, values::count> terminals{};
+			values::invoke([&]<typename t, std::size_t i>() {
+				if constexpr (!page_t<t>) terminals[i] = t::terminal;
+			});
+			return terminals;
+		}();
+		return arg && arg <= values::count && terminals[arg - 1];
+	}
+
+	template <typename t>
+	static constexpr inline bool picked_arg = repeat_of<t> == repeat_policy::first_wins || repeat_of<t> == repeat_policy::last_wins;
+
+	static constexpr inline bool has_picked = values::template value_l<[]<typename t, std::size_t>() { return picked_arg<t>; }>::any;
+
+	// token index + 1 of the occurrence which is parsed, per first/last wins arg
+	using picked_t = std::array<std::size_t, has_picked ? values::count : 0>;
+
+	template <typename char_t>
+	static inline picked_t pick(const args<char_t>& args)
+	{
+		picked_t picked{};
+		if constexpr (has_picked)
+		{
+			constexpr auto policies = [](){
+				std::array<repeat_policy, values::count> policies{};
+				values::invoke([&]<typename t, std::size_t i>() { policies[i] = repeat_of<t>; });
+				return policies;
+			}();
+
+			for (std::size_t k = args.m_index; k < args.m_limit; ++k)
+			{
+				std::size_t arg = args.m_args[k].m_arg;
+				if (!arg || arg > values::count) continue;
+				if (policies[arg - 1] == repeat_policy::last_wins || (policies[arg - 1] == repeat_policy::first_wins && !picked[arg - 1]))
+					picked[arg - 1] = k + 1;
+			}
+		}
+		return picked;
+	}
+
+	// first "--no-" name of each negatable arg, negated tokens point at it so run tells them apart by address,
+	// taken names are tracked apart since comparing the address of a static with null is no constant expression with -fsanitize
+	template <typename char_t>
+	static constexpr inline auto negated_names = [](){
+		std::array<const char_t*, values::count> names{};
+		std::array<bool, values::count> taken{};
+		for (auto& entry : name_table<char_t>)
+			if (entry.m_negated && !taken[entry.m_arg - 1])
+			{
+				names[entry.m_arg - 1] = entry.m_name;
+				taken[entry.m_arg - 1] = true;
+			}
+		return names;
+	}();
+
+	template <typename char_t>
+	static inline void select(typename _ARGLESS_CORE args<char_t>::arg& arg, const name_entry<char_t>& entry)
+	{
+		arg.m_arg = entry.m_arg;
+		if constexpr (has_negatable)
+			if (entry.m_negated)
+				arg.m_value = negated_names<char_t>[entry.m_arg - 1];
+	}
+
+	template <typename char_t>
+	static inline void find_negated(args<char_t>& args, std::size_t i)
+	{
+		auto& arg = args.m_args[i];
+		for (auto& entry : name_table<char_t>)
+			if (entry.m_negated && seq(entry.m_name, arg.m_value))
+				return select(arg, entry);
+	}
+
+	// args named "-c" (name or alias) by ascii c, for clusters (-abc) and attached values (-j8)
+	template <typename char_t>
+	static constexpr inline auto short_table = [](){
+		std::array<name_entry<char_t>, 128> table{};
+		for (auto& entry : name_table<char_t>)
+			if (!entry.m_page && entry.m_size == 2 && entry.m_name[0] == '-' && entry.m_name[1] != '-' && static_cast<char32_t>(entry.m_name[1]) < 128)
+				table[static_cast<char32_t>(entry.m_name[1])] = entry;
+		return table;
+	}();
+
+	// "--" names and aliases sorted by code units, names sharing a prefix are adjacent
+	template <typename char_t>
+	static constexpr inline auto prefix_table = [](){
+		constexpr auto is_long = [](const name_entry<char_t>& entry) { return !entry.m_page && entry.m_size > 2 && entry.m_name[0] == '-' && entry.m_name[1] == '-'; };
+		constexpr std::size_t count = [&](){
+			std::size_t count = 0;
+			for (auto& entry : name_table<char_t>)
+				count += is_long(entry);
+			return count;
+		}();
+
+		std::array<name_entry<char_t>, count> table{};
+		std::size_t size = 0;
+		for (auto& entry : name_table<char_t>)
+			if (is_long(entry))
+				table[size++] = entry;
+		heap_sort(table.data(), size, [](const name_entry<char_t>& l, const name_entry<char_t>& r) { return scmp(l.m_name, r.m_name) < 0; });
+		return table;
+	}();
+
+	// marks a token which is a prefix of several args
+	static constexpr inline std::size_t ambiguous = static_cast<std::size_t>(-1);
+
+	// size of the name part of "--name=value" (whole token without '=')
+	template <typename char_t>
+	static inline std::size_t name_size(const char_t* value)
+	{
+		std::size_t size = 0;
+		while (value[size] && value[size] != '=')
+			++size;
+		return size;
+	}
+
+	// range of prefix_table entries starting with the first size chars of value, two binary searches
+	template <typename char_t>
+	static inline std::pair<std::size_t, std::size_t> prefix_range(const char_t* value, std::size_t size)
+	{
+		auto& table = prefix_table<char_t>;
+		std::size_t first = 0, last = table.size();
+		while (first < last)
+		{
+			std::size_t mid = first + (last - first) / 2;
+			if (scmp_n(table[mid].m_name, value, size) < 0) first = mid + 1;
+			else last = mid;
+		}
+
+		std::size_t end = first;
+		last = table.size();
+		while (end < last)
+		{
+			std::size_t mid = end + (last - end) / 2;
+			if (!scmp_n(table[mid].m_name, value, size)) end = mid + 1;
+			else last = mid;
+		}
+		return { first, end };
+	}
+
+	// selects the arg of an unambiguous "--" prefix (aliases of one arg are not ambiguous) or marks it ambiguous,
+	// "--abbr=value" is resolved on the part before '=' and split like "--name=value", returns count of inserted entries
+	template <typename char_t>
+	static inline std::size_t find_abbreviation(args<char_t>& args, std::size_t i)
+	{
+		using arg_t = typename _ARGLESS_CORE args<char_t>::arg;
+		auto& arg = args.m_args[i];
+		const char_t* value = arg.m_value;
+		if (value[0] != '-' || value[1] != '-')
+			return 0;
+
+		std::size_t size = name_size(value);
+		if (size <= 2)
+			return 0;
+
+		auto [first, end] = prefix_range(value, size);
+		if (first == end)
+			return 0;
+
+		// a whole name is never ambiguous ("--level=3" next to "--level-max")
+		auto& table = prefix_table<char_t>;
+		if (table[first].m_size != size)
+			for (std::size_t j = first + 1; j < end; ++j)
+				if (table[j].m_arg != table[first].m_arg || table[j].m_negated != table[first].m_negated)
+				{
+					arg.m_arg = ambiguous;
+					return 0;
+				}
+
+		if (!value[size])
+		{
+			select(arg, table[first]);
+			return 0;
+		}
+
+		// flags take no "=value", the token stays unmatched
+		if (!table[first].m_value)
+			return 0;
+
+		select(arg, table[first]);
+		args.m_args.insert(args.m_args.begin() + i + 1, arg_t{ value + size + 1 });
+		++args.m_limit;
+		if (args.m_marker) ++args.m_marker;
+		return 1;
+	}
+
+	// first candidate of an ambiguous prefix
+	template <typename char_t>
+	static inline const char_t* suggest_abbreviation(const char_t* value)
+	{
+		auto [first, end] = prefix_range(value, name_size(value));
+		return first != end ? prefix_table<char_t>[first].m_name : nullptr;
+	}
+
+	template <typename char_t>
+	static inline std::size_t split(args<char_t>& args, std::size_t i)
+	{
+		return split_token(args, i, name_table<char_t>.data(), name_table<char_t>.size(), short_table<char_t>.data());
+	}
+
+	template <typename char_t>
+	static inline const char_t* suggest(const char_t* value)
+	{
+		return suggest_name(value, name_table<char_t>.data(), name_table<char_t>.size());
+	}
+
+	// false when parsing has to stop
+	template <typename char_t, std::size_t capacity>
+	static inline bool check_groups(const presence_t& presence, error_sink<char_t, capacity>& sink)
+	{
+		return groups::invoke_none([&]<typename t, std::size_t>() -> bool {
+			std::size_t present = 0;
+			for (std::size_t i = 0; i < presence_words; ++i)
+				present += std::popcount(presence[i] & group_mask<t>[i]);
+
+			if (group_impl<t>::check(present)) return false;
+			auto& error = sink.next();
+			error.m_type = group_impl<t>::error;
+			error.m_arg_name = static_str<group_name<t, char_t>>;
+			return !sink.commit();
+		});
+	}
+
+	// resets values in place (containers keep their capacity)
+	template <typename holder_t>
+	static inline void reset(holder_t& holder)
+	{
+		if constexpr (!std::is_void_v<noname_arg_type>)
+			result_reset<noname_arg_type>::call(holder.m_noname_value);
+
+		values::invoke([&]<typename t, std::size_t i>() {
+			auto& value = std::get<i>(holder.m_values);
+			if constexpr (page_t<t>)
+			{
+				value.m_selected = false;
+				parse_impl<t>::reset(value);
+			}
+			else
+				result_reset<typename t::type>::call(value.m_value);
+		});
+	}
+
+	template <typename char_t>
+	static inline std::size_t find_arg(const char_t* value)
+	{
+		return values::invoke_pipe([&]<typename t, std::size_t t_i>(std::size_t index) -> std::size_t {
+			if constexpr (page_t<t>)
+				return index;
+			else
+			{
+				if (index) return index;
+				return (seq(t::name.data(), value) ||
+					tetter_sequence<tetter_from<decltype(t::aliases)>::count>::invoke_any([&]<typename, std::size_t index>() {
+						return seq(std::get<index>(t::aliases).data(), value);
+					})
+				) ? t_i + 1 : 0;
+			}
+		}, std::size_t(0));
+	}
+
+	// page names are only matched against tokens which are not args
+	template <typename char_t>
+	static inline std::size_t find_page(const char_t* value)
+	{
+		return values::invoke_pipe([&]<typename t, std::size_t t_i>(std::size_t index) -> std::size_t {
+			if constexpr (!page_t<t>)
+				return index;
+			else
+			{
+				if (index) return index;
+				// first char is known at compile-time, so mismatching pages are rejected without seq
+				if (static_cast<char32_t>(*value) != static_cast<char32_t>(t::name.m_buffer[0])) return 0;
+				return seq(t::name.data(), value) ? t_i + 1 : 0;
+			}
+		}, std::size_t(0));
+	}
+
+	// tokens after a page name are left for that page to classify,
+	// after a terminal arg only tokens up to the next arg are classified and m_limit ends after it (forced values can take it)
+	template <typename char_t>
+	static inline void classify(args<char_t>& args, std::size_t from, bool values_only = false)
+	{
+		for (std::size_t i = from; i < args.m_limit; ++i)
+		{
+			auto& arg = args.m_args[i];
+			arg.m_arg = find_arg(arg.m_value);
+
+			if constexpr (has_negatable)
+				if (!arg.m_arg)
+					find_negated(args, i);
+
+			if constexpr (has_pages)
+				if (!arg.m_arg && (arg.m_arg = find_page(arg.m_value)))
+				{
+					if (values_only)
+					{
+						args.m_limit = i + 1;
+						return;
+					}
+					for (++i; i < args.m_limit; ++i)
+						args.m_args[i].m_arg = 0;
+					return;
+				}
+
+			std::size_t added = 0;
+			if constexpr (app_like::abbreviations)
+				if (!arg.m_arg)
+					added = find_abbreviation(args, i);
+
+			if (!args.m_args[i].m_arg)
+				added = split(args, i);
+
+			if constexpr (has_terminal)
+			{
+				if (values_only)
+				{
+					if (args.m_args[i].m_arg)
+					{
+						args.m_limit = i + 1;
+						return;
+					}
+				}
+				else
+					for (std::size_t k = i; k <= i + added; ++k)
+						if (is_terminal(args.m_args[k].m_arg))
+						{
+							args.m_terminal = k + 1;
+							for (std::size_t v = k + 1; v <= i + added; ++v)
+								if (args.m_args[v].m_arg)
+								{
+									args.m_limit = v + 1;
+									return;
+								}
+							classify(args, i + added + 1, true);
+							return;
+						}
+			}
+
+			i += added;
+		}
+	}
+
+	// false when parsing has to stop, after a recoverable error tokens are skipped to the next arg
+	template <typename char_t, std::size_t capacity, typename holder_t>
+	static inline bool run(holder_t& holder, error_sink<char_t, capacity>& sink, args<char_t>& args)
+	{
+		[[maybe_unused]] presence_t presence{};
+		[[maybe_unused]] picked_t picked = pick(args);
+
+		// tokens before a terminal arg are not parsed
+		if constexpr (has_terminal)
+			if (args.m_terminal > args.m_index)
+				args.m_index = args.m_terminal - 1;
+
+		bool opened = false;
+		while (args.m_index < args.m_limit || (opened = end_of_options(args)))
+		{
+			auto& arg_index = args.m_index;
+			auto& arg = args.m_args[arg_index];
+			[[maybe_unused]] std::size_t at = arg_index;
+
+			auto parse = [&]<typename t, std::size_t i>() -> bool
+			{
+				using type = parse_cast<t>;
+				auto insert = [&](auto&&... as) -> bool {
+					constexpr bool merge = [](){
+						if constexpr (i) return values::template get<i-1>::repeat == repeat_policy::merge;
+						else return false;
+					}();
+					bool inserted;
+					if constexpr (merge)
+						inserted = result_merge<t>::call(std::forward<decltype(as)>(as)...);
+					else if constexpr (!i && continued_noname<t>)
+						inserted = opened ? result_merge<t>::call(std::forward<decltype(as)>(as)...) : result_insert<t>::call(std::forward<decltype(as)>(as)...);
+					else
+						inserted = result_insert<t>::call(std::forward<decltype(as)>(as)...);
+					if (!inserted)
+					{
+						auto& error = sink.next();
+						error.m_type = result_error_type::ambiguous_arg_value;
+						error.m_arg_index = arg_index;
+						if constexpr (i) error.m_arg_name = static_str<str_cast<char_t, values::template get<i-1>::name>()>;
+						error.m_arg_type = get_name<type, char_t>();
+						return true;
+					}
+					return false;
+				};
+
+				if constexpr (i && is_negatable<t>::value)
+					if (arg.m_value == negated_names<char_t>[i - 1])
+						return insert(std::get<i - 1>(holder.m_values).m_value, false);
+
+				if constexpr (std::is_void_v<type>)
 				{
 					if constexpr (i)
-						return insert(std::get<i - 1>(result.m_values).m_value);
+						return insert(std::get<i - 1>(holder.m_values).m_value);
 					else
-						return insert(result.m_noname_value);
+						return insert(holder.m_noname_value);
 				}
 				else
 				{
-					auto presult = _ARGLESS_CORE parser<type>::template parse<char_t>(args);
+					auto presult = parser<type>::template parse<char_t>(args);
 
 					if (!presult.is_valid())
 					{
-						result.m_error.m_type = result_error_type::invalid_arg_value;
-						result.m_error.m_arg_index = arg_index;
-						if constexpr (i) result.m_error.m_arg_name = _ARGLESS_CORE static_str<_ARGLESS_CORE str_cast<char_t, args::template get<i-1>::name>()>;
-						result.m_error.m_arg_type = get_name<type, char_t>();
-						result.m_error.m_index = args.m_index;
-						result.m_error.m_expected_type = presult.expected().what();
+						auto& error = sink.next();
+						error.m_type = result_error_type::invalid_arg_value;
+						error.m_arg_index = arg_index;
+						if constexpr (i) error.m_arg_name = static_str<str_cast<char_t, values::template get<i-1>::name>()>;
+						error.m_arg_type = get_name<type, char_t>();
+						error.m_index = args.m_index;
+						error.m_expected_type = presult.expected().what();
+						// at m_limit (e.g. "--name -- x") the value is missing, "--" is not reported as one
+						if (args.m_index < args.m_limit && !args.m_args[args.m_index].m_arg)
+						{
+							error.m_value = args.m_args[args.m_index].m_value;
+							error.m_suggest = &suggest<char_t>;
+						}
 						return true;
 					}
 
 					if constexpr (i)
-						return insert(std::get<i - 1>(result.m_values).m_value, std::move(presult).get());
+						return insert(std::get<i - 1>(holder.m_values).m_value, std::move(presult).get());
 					else
-						return insert(result.m_noname_value, std::move(presult).get());
+						return insert(holder.m_noname_value, std::move(presult).get());
 				}
 
 				return false;
 			};
 
-			if (arg.m_arg)
+			bool failed = false;
+
+			if (app_like::abbreviations && arg.m_arg == ambiguous)
+			{
+				auto& error = sink.next();
+				error.m_type = result_error_type::ambiguous_arg;
+				error.m_index = arg_index;
+				error.m_value = arg.m_value;
+				error.m_suggest = &suggest_abbreviation<char_t>;
+				args.consume();
+				failed = true;
+			}
+			else if (arg.m_arg)
 			{
+				if constexpr (groups::count)
+					presence[(arg.m_arg - 1) / 64] |= std::uint64_t(1) << ((arg.m_arg - 1) % 64);
+
 				args.consume();
-				if (args::invoke_none([&]<typename t, std::size_t i>() -> bool {
+				bool stop = false;
+				values::invoke_any([&]<typename t, std::size_t i>() -> bool {
 					if (i != arg.m_arg - 1) return false;
-					if (parse.template operator()<typename t::type, i + 1>()) return false;
+					if constexpr (page_t<t>)
+					{
+						auto& page = std::get<i>(holder.m_values);
+						page.m_selected = true;
+						parse_impl<t>::classify(args, args.m_index);
+						stop = !parse_impl<t>::run(page, sink, args);
+					}
+					else if constexpr (picked_arg<t>)
+					{
+						if (picked[i] == at + 1)
+							failed = parse.template operator()<typename t::type, i + 1>();
+						else if constexpr (!std::is_void_v<parse_cast<typename t::type>>)
+						{
+							bool negated = false;
+							if constexpr (is_negatable<typename t::type>::value)
+								negated = arg.m_value == negated_names<char_t>[i];
+							if (!negated)
+								parse_skip<parse_cast<typename t::type>>(args);
+						}
+					}
+					else
+						failed = parse.template operator()<typename t::type, i + 1>();
 					return true;
-				})) return result;
+				});
+				if (stop) return false;
+			}
+			else if (args.m_rest)
+			{
+				args.m_rest[args.m_rest_count++] = arg.m_value;
+				args.consume();
 			}
 			else if constexpr (!std::is_void_v<noname_arg_type>)
 			{
-				if (parse.template operator()<noname_arg_type, 0>()) return result;
+				failed = parse.template operator()<noname_arg_type, 0>();
 			}
 			else
 			{
-				result.m_error.m_type = result_error_type::stray_value;
-				result.m_error.m_index = arg_index;
-				return result;
+				auto& error = sink.next();
+				error.m_type = result_error_type::stray_value;
+				error.m_index = arg_index;
+				error.m_value = arg.m_value;
+				error.m_suggest = &suggest<char_t>;
+				failed = true;
+			}
+
+			if (failed)
+			{
+				if (!sink.commit()) return false;
+				while (args.m_index < args.m_limit && !args.m_args[args.m_index].m_arg)
+					args.consume();
 			}
+
+			// terminal arg of this app/page or of a selected page, required args and groups are not checked
+			if constexpr (has_terminal || has_pages)
+				if (args.m_terminal)
+					return true;
 		}
 
-		if (args::invoke_any([&]<typename t, std::size_t i>() -> bool {
-			if constexpr (_ARGLESS_CORE is_required<typename t::type>::value)
+		if (!values::invoke_none([&]<typename t, std::size_t i>() -> bool {
+			if constexpr (page_t<t>)
+				return false;
+			else if constexpr (is_required<typename t::type>::value)
 			{
 				using type = typename t::type;
-				auto& value = std::get<i>(result.m_values).m_value;
+				auto& value = std::get<i>(holder.m_values).m_value;
 				if (!static_cast<bool>(value))
 				{
-					result.m_error.m_type = result_error_type::missing_arg;
-					result.m_error.m_arg_name = _ARGLESS_CORE static_str<_ARGLESS_CORE str_cast<char_t, t::name>()>;
-					result.m_error.m_arg_type = get_name<_ARGLESS_CORE parse_cast<type>, char_t>();
-					return true;
+					auto& error = sink.next();
+					error.m_type = result_error_type::missing_arg;
+					error.m_arg_name = static_str<str_cast<char_t, t::name>()>;
+					error.m_arg_type = get_name<parse_cast<type>, char_t>();
+					return !sink.commit();
 				}
 			}
-			else if constexpr(_ARGLESS_CORE is_default_value<typename t::type>::value)
+			else if constexpr(is_default_value<typename t::type>::value)
 			{
 				using type = typename t::type;
-				auto& value = std::get<i>(result.m_values).m_value;
+				auto& value = std::get<i>(holder.m_values).m_value;
 				if (!value)
 				{
-					if constexpr (std::is_convertible_v<decltype(type::value), typename _ARGLESS_CORE parser<_ARGLESS_CORE parse_cast<type>>::type>) 
+					if constexpr (std::is_convertible_v<decltype(type::value), typename parser<parse_cast<type>>::type>) 
 						value = type::value;
 					else
 						value = type::value();
 				}
 			}
 			return false;
-		})) return result;
+		})) return false;
 
-		result.m_error.m_type = result_error_type::none;
+		if constexpr (groups::count)
+			return check_groups(presence, sink);
+		else
+			return true;
+	}
+
+	// reuses storage of both args and result, returns count of tokens forwarded to rest
+	template <typename char_t, std::size_t capacity>
+	static inline std::size_t parse_into(result<app_like, char_t, capacity>& result, args<char_t>& args, int argc, const char_t** argv, const char_t** rest = nullptr)
+	{
+#if defined(ARGLESS_COMPACT_CORE)
+		if constexpr (!has_pages && !app_like::abbreviations)
+			return compact_parse_into(result, args, argc, argv, rest);
+#endif
+
+		tokenize(args, argc, argv, rest);
+		// argv[0] is the path, never an arg or page
+		classify(args, 1);
+
+		result.m_path = nullptr;
+		reset(result);
+
+		if (auto path = args.peak())
+			result.m_path = (args.consume(), *path);
+
+		error_sink<char_t, capacity> sink{ result.m_errors };
+		run(result, sink, args);
+		if (!(result.m_error_count = sink.m_count))
+			result.m_errors[0] = result_error<char_t>();
+
+		if (rest)
+			rest[args.m_rest_count] = nullptr;
+		return args.m_rest_count;
+	}
+
+	// ARGLESS_COMPACT_CORE: only the value pointers are per app, parsing runs on compact_core and its descriptor tables
+	template <typename char_t, std::size_t capacity>
+	static inline std::size_t compact_parse_into(result<app_like, char_t, capacity>& result, args<char_t>& args, int argc, const char_t** argv, const char_t** rest)
+	{
+		std::array<void*, values::count> value_ptrs;
+		values::invoke([&]<typename, std::size_t i>() { value_ptrs[i] = &std::get<i>(result.m_values).m_value; });
+
+		presence_t presence{};
+		std::array<std::size_t, has_picked ? values::count : 0> picked{};
+
+		compact_state<char_t> state{ value_ptrs.data(), &result.m_noname_value, presence.data(), picked.data(), &result.m_path, result.m_errors, capacity, &result.m_error_count };
+		return compact_core<char_t>::parse_into(compact_tables<app_like, char_t>::table, state, args, argc, argv, rest);
+	}
+};
+
+// entry of every app parse, not inline so translation units sharing an app can declare it extern template
+// and one of them instantiates it (ARGLESS_EXTERN_APP / ARGLESS_INSTANTIATE_APP)
+template <typename app, typename char_t, std::size_t capacity>
+std::size_t parse_entry(result<app, char_t, capacity>& result, args<char_t>& args, int argc, const char_t** argv, std::type_identity_t<const char_t**> rest)
+{
+	return parse_impl<app>::parse_into(result, args, argc, argv, rest);
+}
+
+_ARGLESS_CORE_END
+
+// in a header next to the app: ARGLESS_EXTERN_APP(my_app, char);
+// in one source file: ARGLESS_INSTANTIATE_APP(my_app, char);
+// _N variants are for results of parse_all<n> and parser_context::parse_into with n errors
+#define ARGLESS_EXTERN_APP_N(app, char_t, n) extern template std::size_t _ARGLESS_CORE parse_entry<app, char_t, n>(_ARGLESS result<app, char_t, n>&, _ARGLESS_CORE args<char_t>&, int, const char_t**, const char_t**)
+#define ARGLESS_INSTANTIATE_APP_N(app, char_t, n) template std::size_t _ARGLESS_CORE parse_entry<app, char_t, n>(_ARGLESS result<app, char_t, n>&, _ARGLESS_CORE args<char_t>&, int, const char_t**, const char_t**)
+#define ARGLESS_EXTERN_APP(app, char_t) ARGLESS_EXTERN_APP_N(app, char_t, 1)
+#define ARGLESS_INSTANTIATE_APP(app, char_t) ARGLESS_INSTANTIATE_APP_N(app, char_t, 1)
+
+_ARGLESS_BEGIN
+
+template <_ARGLESS_CORE str name_, _ARGLESS_CORE str desc_, _ARGLESS_CORE parsable noname_arg_type_, _ARGLESS_CORE app_arg_t... args_>
+	requires _ARGLESS_CORE no_name_or_alias_collision<args_...>
+struct app
+{
+public:
+	static constexpr auto name = name_;
+	static constexpr auto desc = desc_;
+	using noname_arg_type = noname_arg_type_;
+	using args = typename tetter<args_...>::template filter_l<[]<typename t, std::size_t>() { return _ARGLESS_CORE arg_t<t> || _ARGLESS_CORE page_t<t>; }>;
+	using groups = typename tetter<args_...>::template filter_l<[]<typename t, std::size_t>() { return _ARGLESS_CORE group_t<t>; }>;
+	static constexpr inline bool abbreviations = (std::is_same_v<args_, _ARGLESS abbreviations> || ...);
+
+public:
+	template <typename char_t>
+	static result<app, char_t> parse(int argc, const char_t** argv)
+	{
+		result<app, char_t> result;
+		_ARGLESS_CORE args<char_t> args;
+		_ARGLESS_CORE parse_entry(result, args, argc, argv, nullptr);
 		return result;
 	}
+
+	// keeps parsing after recoverable errors (skipping to the next arg) and records up to n errors
+	template <std::size_t n, typename char_t>
+	static result<app, char_t, n> parse_all(int argc, const char_t** argv)
+	{
+		result<app, char_t, n> result;
+		_ARGLESS_CORE args<char_t> args;
+		_ARGLESS_CORE parse_entry(result, args, argc, argv, nullptr);
+		return result;
+	}
+
+	// tokens which are not args/pages (or their values) are written to rest in order, without copying,
+	// rest must have room for argc entries and is nullptr terminated (ready for execv)
+	template <typename char_t>
+	static result<app, char_t> parse_known(int argc, const char_t** argv, const char_t** rest, std::size_t* rest_count = nullptr)
+	{
+		result<app, char_t> result;
+		_ARGLESS_CORE args<char_t> args;
+		std::size_t count = _ARGLESS_CORE parse_entry(result, args, argc, argv, rest);
+		if (rest_count) *rest_count = count;
+		return result;
+	}
+
+	// lines: range of argv spans (std::size + std::data), results are in input order
+	template <typename lines_t>
+	static auto parse_batch(const lines_t& lines, std::size_t thread_count = 0)
+	{
+		return _ARGLESS_CORE batch<app, lines_t>::parse(lines, thread_count);
+	}
+
+	template <typename lines_t>
+	static auto validate_batch(const lines_t& lines, std::size_t thread_count = 0)
+	{
+		return _ARGLESS_CORE batch<app, lines_t>::validate(lines, thread_count);
+	}
+};
+
+// keeps token table and result storage between parse calls (REPL/server workloads)
+template <_ARGLESS_CORE app_t app, typename char_t>
+struct parser_context
+{
+public:
+	inline parser_context() = default;
+	inline parser_context(const parser_context&) = default;
+	inline parser_context(parser_context&&) = default;
+	inline parser_context& operator=(const parser_context&) = default;
+	inline parser_context& operator=(parser_context&&) = default;
+	inline ~parser_context() = default;
+
+public:
+	inline result<app, char_t> parse(int argc, const char_t** argv)
+	{
+		result<app, char_t> result;
+		_ARGLESS_CORE parse_entry(result, m_args, argc, argv, nullptr);
+		return result;
+	}
+
+	template <std::size_t error_capacity>
+	inline result<app, char_t, error_capacity>& parse_into(result<app, char_t, error_capacity>& result, int argc, const char_t** argv)
+	{
+		_ARGLESS_CORE parse_entry(result, m_args, argc, argv, nullptr);
+		return result;
+	}
+
+	inline result<app, char_t> parse_known(int argc, const char_t** argv, const char_t** rest, std::size_t* rest_count = nullptr)
+	{
+		result<app, char_t> result;
+		std::size_t count = _ARGLESS_CORE parse_entry(result, m_args, argc, argv, rest);
+		if (rest_count) *rest_count = count;
+		return result;
+	}
+
+private:
+	_ARGLESS_CORE args<char_t> m_args;
 };
 
 _ARGLESS_END
@@ -723,6 +2039,10 @@ struct parser<rename<t, new_name>>
 
 	template <typename char_t>
 	static constexpr inline auto name = _ARGLESS_CORE str_cast<char_t, new_name>();
+
+	template <typename char_t>
+		requires requires { parser<t>::template completions<char_t>; }
+	static constexpr inline auto completions = parser<t>::template completions<char_t>;
 };
 
 template <typename t>
@@ -742,6 +2062,10 @@ struct parser<force<t>>
 
 	template <typename char_t>
 	static constexpr inline auto name = parser<t>::template name<char_t>;
+
+	template <typename char_t>
+		requires requires { parser<t>::template completions<char_t>; }
+	static constexpr inline auto completions = parser<t>::template completions<char_t>;
 };
 
 template <typename t, auto value>
@@ -755,8 +2079,8 @@ struct parser<fallback<t, value>>
 		auto result = parser<t>::template parse<char_t>(args);
 		if (!result.is_valid())
 		{
-			if constexpr (std::is_invocable_v<decltype(value)>) return t(value());
-			else return t(value);
+			if constexpr (std::is_invocable_v<decltype(value)>) return type(t(value()));
+			else return type(t(value));
 		}
 
 		return result;
@@ -764,6 +2088,10 @@ struct parser<fallback<t, value>>
 
 	template <typename char_t>
 	static constexpr inline auto name = parser<t>::template name<char_t>;
+
+	template <typename char_t>
+		requires requires { parser<t>::template completions<char_t>; }
+	static constexpr inline auto completions = parser<t>::template completions<char_t>;
 };
 
 template <auto lambda>
@@ -784,6 +2112,10 @@ struct parser<transform<lambda>>
 
 	template <typename char_t>
 	static constexpr inline auto name = parser<t>::template name<char_t>;
+
+	template <typename char_t>
+		requires requires { parser<t>::template completions<char_t>; }
+	static constexpr inline auto completions = parser<t>::template completions<char_t>;
 };
 
 template <auto lambda>
@@ -806,6 +2138,10 @@ struct parser<validate<lambda>>
 
 	template <typename char_t>
 	static constexpr inline auto name = parser<type>::template name<char_t>;
+
+	template <typename char_t>
+		requires requires { parser<type>::template completions<char_t>; }
+	static constexpr inline auto completions = parser<type>::template completions<char_t>;
 };
 
 template <>
@@ -856,6 +2192,9 @@ struct parser<option<names...>>
 	template <typename char_t>
 	static constexpr inline auto name = vs::pop_front::invoke_pipe([]<typename t>(auto str){ return [](){ return or_name<decltype(str){}(), (str_from<char_t, "'">() + str_cast<char_t, t::value>() + str_from<char_t, "'">())>(); }; },
 		[](){ return str_from<char_t, "'">() + str_cast<char_t, vs::front::value>() + str_from<char_t, "'">(); })();
+
+	template <typename char_t>
+	static constexpr inline completion_list<char_t, sizeof...(names)> completions = { static_str<str_cast<char_t, names>()>.data()... };
 };
 
 _ARGLESS_CORE_END
@@ -0,0 +1,128 @@
+#pragma once
+#include "argless.hpp"
+
+#if defined(ARGLESS_STDH_THREAD) || defined(_GLIBCXX_THREAD) || defined(_LIBCPP_THREAD) || defined(_THREAD_)
+
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <iterator>
+
+_ARGLESS_CORE_BEGIN
+
+template <_ARGLESS_CORE app_t app, typename lines_t>
+	requires requires (const lines_t& lines) { std::size(lines); std::data(std::begin(lines)[0]); std::size(std::begin(lines)[0]); }
+struct batch<app, lines_t>
+{
+	using char_t = std::remove_cvref_t<std::remove_pointer_t<std::remove_cvref_t<decltype(*std::data(std::begin(std::declval<const lines_t&>())[0]))>>>;
+
+	// workers claim the next fixed chunk of lines from a shared atomic cursor until it passes the end
+	static constexpr inline std::size_t chunk = 64;
+
+	template <typename worker_t>
+	static inline void run(const lines_t& lines, std::size_t thread_count, worker_t&& worker)
+	{
+		const std::size_t count = std::size(lines);
+
+		if (!thread_count)
+			thread_count = std::thread::hardware_concurrency();
+		if (thread_count > (count + chunk - 1) / chunk)
+			thread_count = (count + chunk - 1) / chunk;
+		if (!thread_count)
+			thread_count = 1;
+
+		std::atomic<std::size_t> cursor = 0;
+		std::exception_ptr exception;
+		std::atomic<bool> failed = false;
+
+		auto work = [&](){
+			try
+			{
+				parser_context<app, char_t> context;
+				auto state = worker.make_state();
+				while (!failed.load(std::memory_order_relaxed))
+				{
+					std::size_t from = cursor.fetch_add(chunk, std::memory_order_relaxed);
+					if (from >= count) break;
+					std::size_t to = from + chunk < count ? from + chunk : count;
+
+					for (std::size_t i = from; i < to; ++i)
+					{
+						auto& line = std::begin(lines)[i];
+						worker(context, state, i, static_cast<int>(std::size(line)), const_cast<const char_t**>(std::data(line)));
+					}
+				}
+			}
+			catch (...)
+			{
+				if (!failed.exchange(true))
+					exception = std::current_exception();
+			}
+		};
+
+		std::vector<std::thread> threads;
+		threads.reserve(thread_count - 1);
+		try
+		{
+			for (std::size_t i = 1; i < thread_count; ++i)
+				threads.emplace_back(work);
+		}
+		catch (...)
+		{
+			// started threads stop at their next chunk and are joined, destroying them unjoined would terminate
+			failed = true;
+			for (auto& thread : threads)
+				thread.join();
+			throw;
+		}
+		work();
+		for (auto& thread : threads)
+			thread.join();
+
+		if (exception)
+			std::rethrow_exception(exception);
+	}
+
+	static inline std::vector<result<app, char_t>> parse(const lines_t& lines, std::size_t thread_count)
+	{
+		std::vector<result<app, char_t>> results(std::size(lines));
+
+		struct worker
+		{
+			std::vector<result<app, char_t>>& m_results;
+
+			inline int make_state() { return 0; }
+			inline void operator()(parser_context<app, char_t>& context, int, std::size_t i, int argc, const char_t** argv)
+			{
+				context.parse_into(m_results[i], argc, argv);
+			}
+		};
+
+		run(lines, thread_count, worker{ results });
+		return results;
+	}
+
+	static inline std::vector<result_error<char_t>> validate(const lines_t& lines, std::size_t thread_count)
+	{
+		std::vector<result_error<char_t>> errors(std::size(lines));
+
+		struct worker
+		{
+			std::vector<result_error<char_t>>& m_errors;
+
+			// one result per worker, reused for every line
+			inline result<app, char_t> make_state() { return {}; }
+			inline void operator()(parser_context<app, char_t>& context, result<app, char_t>& result, std::size_t i, int argc, const char_t** argv)
+			{
+				m_errors[i] = context.parse_into(result, argc, argv).error();
+			}
+		};
+
+		run(lines, thread_count, worker{ errors });
+		return errors;
+	}
+};
+
+_ARGLESS_CORE_END
+
+#endif
@@ -0,0 +1,438 @@
+#pragma once
+#include "argless.hpp"
+
+_ARGLESS_CORE_BEGIN
+
+// with ARGLESS_COMPACT_CORE apps and pages without sub pages or abbreviations are parsed by one loop per char type,
+// every arg is reduced to a descriptor whose functions only depend on the arg type, so apps share them
+// (define it for the whole program, parse code of an app differs with it)
+
+template <typename char_t>
+struct compact_arg
+{
+	const char_t* m_name = nullptr;
+	const char_t* m_type = nullptr;
+	const char_t* m_negated = nullptr; // first "--no-" name, negated tokens point at it
+
+	// inserts flag or parsed value into the storage, on invalid value expected names the expected type
+	result_error_type (*m_store)(void* storage, args<char_t>& args, bool negated, const char_t*& expected) = nullptr;
+	bool (*m_skip)(args<char_t>& args) = nullptr; // non-winning occurrence of first/last wins arg with a value
+	void (*m_reset)(void* storage) = nullptr;
+	bool (*m_finish)(void* storage) = nullptr; // false when a required arg is missing, fills default values
+
+	repeat_policy m_repeat = repeat_policy::error;
+	bool m_terminal = false;
+};
+
+template <typename char_t>
+struct compact_group
+{
+	const std::uint64_t* m_mask = nullptr;
+	bool (*m_check)(std::size_t present) = nullptr;
+	result_error_type m_error = result_error_type::none;
+	const char_t* m_name = nullptr;
+};
+
+template <typename char_t>
+struct compact_table
+{
+	const compact_arg<char_t>* m_args;
+	std::size_t m_count;
+	const name_entry<char_t>* m_names; // sorted by code units
+	std::size_t m_name_count;
+	const name_entry<char_t>* m_shorts; // "-c" names by ascii c
+	compact_arg<char_t> m_noname; // no m_store when noname arg is void
+	compact_arg<char_t> m_noname_opened; // noname arg after "--", merges continued nonames
+	const compact_group<char_t>* m_groups;
+	std::size_t m_group_count;
+	std::size_t m_presence_words;
+	const char_t* (*m_suggest)(const char_t*);
+	bool m_terminal; // any arg is terminal
+	bool m_picked; // any arg is first/last wins
+};
+
+// per call storage of one result
+template <typename char_t>
+struct compact_state
+{
+	void* const* m_values;
+	void* m_noname;
+	std::uint64_t* m_presence;
+	std::size_t* m_picked;
+	const char_t** m_path;
+	result_error<char_t>* m_errors;
+	std::size_t m_capacity;
+	std::size_t* m_error_count;
+};
+
+template <typename t, bool merge, typename char_t>
+inline result_error_type compact_store(void* storage, args<char_t>& args, [[maybe_unused]] bool negated, [[maybe_unused]] const char_t*& expected)
+{
+	using type = parse_cast<t>;
+	auto& value = *static_cast<result_cast<t>*>(storage);
+	auto insert = [&](auto&&... as) -> result_error_type {
+		bool inserted;
+		if constexpr (merge)
+			inserted = result_merge<t>::call(value, std::forward<decltype(as)>(as)...);
+		else
+			inserted = result_insert<t>::call(value, std::forward<decltype(as)>(as)...);
+		return inserted ? result_error_type::none : result_error_type::ambiguous_arg_value;
+	};
+
+	if constexpr (is_negatable<t>::value)
+		if (negated)
+			return insert(false);
+
+	if constexpr (std::is_void_v<type>)
+		return insert();
+	else
+	{
+		auto presult = parser<type>::template parse<char_t>(args);
+		if (!presult.is_valid())
+		{
+			expected = presult.expected().what();
+			return result_error_type::invalid_arg_value;
+		}
+		return insert(std::move(presult).get());
+	}
+}
+
+template <typename t, typename char_t>
+inline bool compact_skip(args<char_t>& args) { return parse_skip<parse_cast<t>>(args); }
+
+template <typename t>
+inline void compact_reset(void* storage) { result_reset<t>::call(*static_cast<result_cast<t>*>(storage)); }
+
+template <typename t>
+inline bool compact_finish(void* storage)
+{
+	auto& value = *static_cast<result_cast<t>*>(storage);
+	if constexpr (is_required<t>::value)
+		return static_cast<bool>(value);
+	else
+	{
+		if (!value)
+		{
+			if constexpr (std::is_convertible_v<decltype(t::value), typename parser<parse_cast<t>>::type>)
+				value = t::value;
+			else
+				value = t::value();
+		}
+		return true;
+	}
+}
+
+template <typename t, typename char_t, repeat_policy repeat = repeat_policy::error>
+inline constexpr compact_arg<char_t> make_compact_arg(const char_t* name, const char_t* negated)
+{
+	compact_arg<char_t> arg;
+	arg.m_name = name;
+	arg.m_type = get_name<parse_cast<t>, char_t>();
+	arg.m_negated = negated;
+	arg.m_store = &compact_store<t, repeat == repeat_policy::merge, char_t>;
+	if constexpr (!std::is_void_v<parse_cast<t>>)
+		arg.m_skip = &compact_skip<t, char_t>;
+	arg.m_reset = &compact_reset<t>;
+	if constexpr (is_required<t>::value || is_default_value<t>::value)
+		arg.m_finish = &compact_finish<t>;
+	arg.m_repeat = repeat;
+	return arg;
+}
+
+// descriptor tables of an app/page, built at compile-time from parse_impl tables
+template <typename app_like, typename char_t>
+struct compact_tables
+{
+	using impl = parse_impl<app_like>;
+	using values = typename app_like::args;
+	using groups = typename app_like::groups;
+
+	static constexpr inline auto arg_table = [](){
+		std::array<compact_arg<char_t>, values::count> table{};
+		values::invoke([&]<typename t, std::size_t i>() {
+			table[i] = make_compact_arg<typename t::type, char_t, t::repeat>(static_str<str_cast<char_t, t::name>()>, impl::template negated_names<char_t>[i]);
+			table[i].m_terminal = t::terminal;
+		});
+		return table;
+	}();
+
+	static constexpr inline auto names = [](){
+		auto names = impl::template name_table<char_t>;
+		heap_sort(names.data(), names.size(), [](const name_entry<char_t>& l, const name_entry<char_t>& r) { return scmp(l.m_name, r.m_name) < 0; });
+		return names;
+	}();
+
+	static constexpr inline auto group_table = [](){
+		std::array<compact_group<char_t>, groups::count> table{};
+		groups::invoke([&]<typename t, std::size_t i>() {
+			table[i] = { impl::template group_mask<t>.data(), &group_impl<t>::check, group_impl<t>::error, static_str<group_name<t, char_t>> };
+		});
+		return table;
+	}();
+
+	static constexpr inline compact_arg<char_t> noname = [](){
+		if constexpr (std::is_void_v<typename app_like::noname_arg_type>)
+			return compact_arg<char_t>();
+		else
+			return make_compact_arg<typename app_like::noname_arg_type, char_t>(nullptr, nullptr);
+	}();
+
+	static constexpr inline compact_arg<char_t> noname_opened = [](){
+		if constexpr (continued_noname<typename app_like::noname_arg_type>)
+			return make_compact_arg<typename app_like::noname_arg_type, char_t, repeat_policy::merge>(nullptr, nullptr);
+		else
+			return noname;
+	}();
+
+	static constexpr inline compact_table<char_t> table = {
+		arg_table.data(), arg_table.size(),
+		names.data(), names.size(),
+		impl::template short_table<char_t>.data(),
+		noname,
+		noname_opened,
+		group_table.data(), group_table.size(),
+		impl::presence_words,
+		&impl::template suggest<char_t>,
+		impl::has_terminal,
+		impl::has_picked,
+	};
+};
+
+template <typename char_t>
+struct compact_core
+{
+	struct sink
+	{
+		result_error<char_t>* m_errors;
+		std::size_t m_capacity;
+		std::size_t m_count = 0;
+
+		inline result_error<char_t>& next() { return m_errors[m_count] = result_error<char_t>(); }
+		inline bool commit() { return ++m_count < m_capacity; }
+	};
+
+	// exact match by binary search, negated names are replaced by the first "--no-" name of their arg
+	static inline void find(const compact_table<char_t>& table, typename args<char_t>::arg& arg)
+	{
+		std::size_t first = 0, last = table.m_name_count;
+		while (first < last)
+		{
+			std::size_t mid = first + (last - first) / 2;
+			int cmp = scmp(table.m_names[mid].m_name, arg.m_value);
+			if (!cmp)
+			{
+				auto& entry = table.m_names[mid];
+				arg.m_arg = entry.m_arg;
+				if (entry.m_negated)
+					arg.m_value = table.m_args[entry.m_arg - 1].m_negated;
+				return;
+			}
+			if (cmp < 0) first = mid + 1;
+			else last = mid;
+		}
+	}
+
+	static inline bool is_terminal(const compact_table<char_t>& table, std::size_t arg)
+	{
+		return arg && arg <= table.m_count && table.m_args[arg - 1].m_terminal;
+	}
+
+	// same as parse_impl::classify without pages and abbreviations
+	static inline void classify(const compact_table<char_t>& table, args<char_t>& args, std::size_t from, bool values_only = false)
+	{
+		for (std::size_t i = from; i < args.m_limit; ++i)
+		{
+			find(table, args.m_args[i]);
+			std::size_t added = args.m_args[i].m_arg ? 0 : split_token(args, i, table.m_names, table.m_name_count, table.m_shorts);
+
+			if (table.m_terminal)
+			{
+				if (values_only)
+				{
+					if (args.m_args[i].m_arg)
+					{
+						args.m_limit = i + 1;
+						return;
+					}
+				}
+				else
+					for (std::size_t k = i; k <= i + added; ++k)
+						if (is_terminal(table, args.m_args[k].m_arg))
+						{
+							args.m_terminal = k + 1;
+							for (std::size_t v = k + 1; v <= i + added; ++v)
+								if (args.m_args[v].m_arg)
+								{
+									args.m_limit = v + 1;
+									return;
+								}
+							classify(table, args, i + added + 1, true);
+							return;
+						}
+			}
+
+			i += added;
+		}
+	}
+
+	static inline void pick(const compact_table<char_t>& table, const compact_state<char_t>& state, const args<char_t>& args)
+	{
+		for (std::size_t k = args.m_index; k < args.m_limit; ++k)
+		{
+			std::size_t arg = args.m_args[k].m_arg;
+			if (!arg || arg > table.m_count) continue;
+			auto repeat = table.m_args[arg - 1].m_repeat;
+			if (repeat == repeat_policy::last_wins || (repeat == repeat_policy::first_wins && !state.m_picked[arg - 1]))
+				state.m_picked[arg - 1] = k + 1;
+		}
+	}
+
+	// true on error
+	static inline bool store(const compact_table<char_t>& table, const compact_arg<char_t>& desc, void* storage, sink& sink, args<char_t>& args, bool negated)
+	{
+		const char_t* expected = nullptr;
+		auto type = desc.m_store(storage, args, negated, expected);
+		if (type == result_error_type::none)
+			return false;
+
+		auto& error = sink.next();
+		error.m_type = type;
+		error.m_arg_index = args.m_index;
+		error.m_arg_name = desc.m_name;
+		error.m_arg_type = desc.m_type;
+		if (type == result_error_type::invalid_arg_value)
+		{
+			error.m_index = args.m_index;
+			error.m_expected_type = expected;
+			// at m_limit (e.g. "--name -- x") the value is missing, "--" is not reported as one
+			if (args.m_index < args.m_limit && !args.m_args[args.m_index].m_arg)
+			{
+				error.m_value = args.m_args[args.m_index].m_value;
+				error.m_suggest = table.m_suggest;
+			}
+		}
+		return true;
+	}
+
+	// same as parse_impl::run without pages and abbreviations
+	static inline bool run(const compact_table<char_t>& table, const compact_state<char_t>& state, sink& sink, args<char_t>& args)
+	{
+		if (table.m_picked)
+			pick(table, state, args);
+
+		// tokens before a terminal arg are not parsed
+		if (args.m_terminal > args.m_index)
+			args.m_index = args.m_terminal - 1;
+
+		bool opened = false;
+		while (args.m_index < args.m_limit || (opened = end_of_options(args)))
+		{
+			std::size_t at = args.m_index;
+			auto& arg = args.m_args[at];
+			bool failed = false;
+
+			if (arg.m_arg)
+			{
+				std::size_t i = arg.m_arg - 1;
+				auto& desc = table.m_args[i];
+				if (table.m_group_count)
+					state.m_presence[i / 64] |= std::uint64_t(1) << (i % 64);
+
+				args.consume();
+				bool negated = desc.m_negated && arg.m_value == desc.m_negated;
+				if ((desc.m_repeat == repeat_policy::first_wins || desc.m_repeat == repeat_policy::last_wins) && state.m_picked[i] != at + 1)
+				{
+					if (desc.m_skip && !negated)
+						desc.m_skip(args);
+				}
+				else
+					failed = store(table, desc, state.m_values[i], sink, args, negated);
+			}
+			else if (args.m_rest)
+			{
+				args.m_rest[args.m_rest_count++] = arg.m_value;
+				args.consume();
+			}
+			else if (table.m_noname.m_store)
+			{
+				failed = store(table, opened ? table.m_noname_opened : table.m_noname, state.m_noname, sink, args, false);
+			}
+			else
+			{
+				auto& error = sink.next();
+				error.m_type = result_error_type::stray_value;
+				error.m_index = at;
+				error.m_value = arg.m_value;
+				error.m_suggest = table.m_suggest;
+				failed = true;
+			}
+
+			if (failed)
+			{
+				if (!sink.commit()) return false;
+				while (args.m_index < args.m_limit && !args.m_args[args.m_index].m_arg)
+					args.consume();
+			}
+
+			// terminal arg, required args and groups are not checked
+			if (args.m_terminal)
+				return true;
+		}
+
+		for (std::size_t i = 0; i < table.m_count; ++i)
+		{
+			auto& desc = table.m_args[i];
+			if (desc.m_finish && !desc.m_finish(state.m_values[i]))
+			{
+				auto& error = sink.next();
+				error.m_type = result_error_type::missing_arg;
+				error.m_arg_name = desc.m_name;
+				error.m_arg_type = desc.m_type;
+				if (!sink.commit()) return false;
+			}
+		}
+
+		for (std::size_t g = 0; g < table.m_group_count; ++g)
+		{
+			auto& group = table.m_groups[g];
+			std::size_t present = 0;
+			for (std::size_t i = 0; i < table.m_presence_words; ++i)
+				present += std::popcount(state.m_presence[i] & group.m_mask[i]);
+
+			if (group.m_check(present)) continue;
+			auto& error = sink.next();
+			error.m_type = group.m_error;
+			error.m_arg_name = group.m_name;
+			if (!sink.commit()) return false;
+		}
+
+		return true;
+	}
+
+	static inline std::size_t parse_into(const compact_table<char_t>& table, const compact_state<char_t>& state, args<char_t>& args, int argc, const char_t** argv, const char_t** rest)
+	{
+		tokenize(args, argc, argv, rest);
+		// argv[0] is the path, never an arg
+		classify(table, args, 1);
+
+		*state.m_path = nullptr;
+		if (table.m_noname.m_reset)
+			table.m_noname.m_reset(state.m_noname);
+		for (std::size_t i = 0; i < table.m_count; ++i)
+			table.m_args[i].m_reset(state.m_values[i]);
+
+		if (auto path = args.peak())
+			*state.m_path = (args.consume(), *path);
+
+		sink sink{ state.m_errors, state.m_capacity };
+		run(table, state, sink, args);
+		if (!(*state.m_error_count = sink.m_count))
+			state.m_errors[0] = result_error<char_t>();
+
+		if (rest)
+			rest[args.m_rest_count] = nullptr;
+		return args.m_rest_count;
+	}
+};
+
+_ARGLESS_CORE_END
@@ -0,0 +1,257 @@
+#pragma once
+#include "argless.hpp"
+#include "helper.hpp"
+
+_ARGLESS_BEGIN
+
+enum class completion_shell
+{
+	bash,
+	zsh,
+	fish,
+};
+
+_ARGLESS_END
+_ARGLESS_CORE_BEGIN
+
+// classifies words up to the cursor only, values are never converted or validated
+template <typename app_like>
+struct complete_impl
+{
+	using impl = parse_impl<app_like>;
+	using values = typename app_like::args;
+
+	// arg of "--name=value" or of the last short of a "-abc" cluster which takes a value (like split_token),
+	// attached is set to its value part in the token, nullptr if the value is the next token
+	template <typename char_t>
+	static inline std::size_t find_attached(const char_t* value, const char_t*& attached)
+	{
+		attached = nullptr;
+		if (value[0] != '-' || !value[1])
+			return 0;
+
+		for (const char_t* it = value + 1; *it; ++it)
+			if (*it == '=')
+			{
+				for (auto& entry : impl::template name_table<char_t>)
+					if (entry.m_value && entry.m_size == static_cast<std::size_t>(it - value) && seq_n(entry.m_name, value, entry.m_size))
+					{
+						attached = it + 1;
+						return entry.m_arg;
+					}
+				return 0;
+			}
+
+		if (value[1] == '-')
+			return 0;
+
+		auto& shorts = impl::template short_table<char_t>;
+		for (const char_t* it = value + 1; *it; ++it)
+		{
+			if (static_cast<char32_t>(*it) >= 128 || !shorts[static_cast<char32_t>(*it)].m_arg)
+				return 0;
+			if (shorts[static_cast<char32_t>(*it)].m_value)
+			{
+				if (it[1]) attached = it + 1;
+				return shorts[static_cast<char32_t>(*it)].m_arg;
+			}
+		}
+		return 0;
+	}
+
+	// arg is not a flag, the word after it is its value
+	static inline bool takes_value(std::size_t arg)
+	{
+		bool value = false;
+		values::invoke([&]<typename t, std::size_t t_i>() {
+			if constexpr (!page_t<t>)
+				if constexpr (!std::is_void_v<parse_cast<typename t::type>>)
+					if (t_i == arg - 1)
+						value = true;
+		});
+		return value;
+	}
+
+	// last word is the one under the cursor (may be empty)
+	template <typename char_t, typename emit_t>
+	static inline void run(const char_t* const* words, std::size_t count, emit_t& emit)
+	{
+		std::size_t last = 0;
+		const char_t* attached = nullptr;
+		for (std::size_t i = 0; i + 1 < count; ++i)
+		{
+			// words after "--" are values only, there is nothing to offer
+			if (words[i][0] == '-' && words[i][1] == '-' && !words[i][2])
+				return;
+
+			bool waiting = last && takes_value(last);
+			if ((last = impl::find_arg(words[i])))
+				continue;
+
+			// "-vj" waits for the value of -j, "-j8" and "--name=value" already have it
+			if ((last = find_attached(words[i], attached)) && attached)
+				last = 0;
+			if (last)
+				continue;
+
+			// value of the arg before it ("-o build"), never a page
+			if (waiting)
+				continue;
+
+			if constexpr (impl::has_pages)
+				if (std::size_t page = impl::find_page(words[i]))
+				{
+					values::invoke([&]<typename t, std::size_t t_i>() {
+						if constexpr (page_t<t>)
+							if (t_i == page - 1)
+								complete_impl<t>::run(words + i + 1, count - i - 1, emit);
+					});
+					return;
+				}
+		}
+
+		const char_t empty[1] = {};
+		const char_t* current = count ? words[count - 1] : empty;
+
+		// value typed in the current word ("--name=va", "-vjva"), candidates keep the part before it
+		const char_t* value_begin = current;
+		if (std::size_t arg = find_attached(current, attached); arg && attached)
+		{
+			last = arg;
+			value_begin = attached;
+		}
+
+		// value of the arg before cursor
+		bool value = false;
+		if (last)
+			values::invoke([&]<typename t, std::size_t t_i>() {
+				if constexpr (!page_t<t>)
+				{
+					using type = parse_cast<typename t::type>;
+					if constexpr (!std::is_void_v<type>)
+						if (t_i == last - 1)
+						{
+							value = true;
+							if constexpr (requires { parser<type>::template completions<char_t>; })
+							{
+								std::basic_string<char_t> joined(current, value_begin);
+								for (auto completion : parser<type>::template completions<char_t>)
+									if (sprefix(value_begin, completion))
+									{
+										if (value_begin == current)
+											emit(completion);
+										else
+										{
+											joined.resize(static_cast<std::size_t>(value_begin - current));
+											joined += completion;
+											emit(joined.c_str());
+										}
+									}
+							}
+						}
+				}
+			});
+		if (value) return;
+
+		for (auto& entry : impl::template name_table<char_t>)
+			if (sprefix(current, entry.m_name)) emit(entry.m_name);
+	}
+};
+
+/*
+ * scripts call "APP::NAME __complete WORDS... CURRENT" and use printed lines as candidates,
+ * shell falls back to file completion when there are none
+ */
+
+template <typename app, completion_shell shell>
+inline constexpr void completion_script_write(help_writer<char>& out)
+{
+	constexpr auto name = str_cast<char, app::name>();
+
+	if constexpr (shell == completion_shell::bash)
+	{
+		// COMP_WORDS splits "--name=value" at '=', words are taken from the line and the part of the
+		// current word bash does not replace is cut from the candidates
+		out << "_argless_" << name << "() {\n"
+			<< "\tlocal IFS=$'\\n' line=\"${COMP_LINE:0:$COMP_POINT}\" words\n"
+			<< "\tIFS=$' \\t' read -ra words <<< \"$line\"\n"
+			<< "\t[[ \"$line\" == *[[:space:]] ]] && words+=(\"\")\n"
+			<< "\tlocal current=\"${words[${#words[@]}-1]}\" word=\"${COMP_WORDS[$COMP_CWORD]}\"\n"
+			<< "\tCOMPREPLY=($(\"${words[0]}\" __complete \"${words[@]:1}\" 2>/dev/null))\n"
+			<< "\tCOMPREPLY=(\"${COMPREPLY[@]#\"${current%\"$word\"}\"}\")\n"
+			<< "}\n"
+			<< "complete -o default -F _argless_" << name << ' ' << name << '\n';
+	}
+	else if constexpr (shell == completion_shell::zsh)
+	{
+		out << "#compdef " << name << '\n'
+			<< "_argless_" << name << "() {\n"
+			<< "\tlocal -a candidates\n"
+			<< "\tcandidates=(${(f)\"$(\"${words[1]}\" __complete \"${(@)words[2,CURRENT]}\" 2>/dev/null)\"})\n"
+			<< "\tif (( ${#candidates} )); then compadd -a candidates; else _files; fi\n"
+			<< "}\n"
+			<< "compdef _argless_" << name << ' ' << name << '\n';
+	}
+	else
+	{
+		out << "complete -c " << name << " -a '(" << name << " __complete (commandline -opc)[2..-1] (commandline -ct) 2>/dev/null)'\n";
+	}
+}
+
+template <typename app, completion_shell shell>
+constexpr inline auto completion_script_text = [](){
+	constexpr std::size_t size = [](){ help_writer<char> out; completion_script_write<app, shell>(out); return out.m_size; }();
+	str<char, size + 1> text;
+	help_writer<char> out{ text.m_buffer, size };
+	completion_script_write<app, shell>(out);
+	return text;
+}();
+
+_ARGLESS_CORE_END
+_ARGLESS_BEGIN
+
+// script to source/eval in shell, generated at compile-time
+template <_ARGLESS_CORE app_t app, completion_shell shell>
+inline constexpr std::string_view completion_script()
+{
+	return { _ARGLESS_CORE completion_script_text<app, shell>.data(), _ARGLESS_CORE completion_script_text<app, shell>.size() - 1 };
+}
+
+// handles "prog __complete words... current" by calling emit(const char_t*) for every candidate,
+// returns false (and does nothing) for any other invocation
+template <_ARGLESS_CORE app_t app, typename char_t, typename emit_t>
+inline bool complete(int argc, const char_t** argv, emit_t&& emit)
+{
+	if (argc < 2 || !_ARGLESS_CORE seq(argv[1], "__complete"))
+		return false;
+
+	_ARGLESS_CORE complete_impl<app>::run(argv + 2, static_cast<std::size_t>(argc - 2), emit);
+	return true;
+}
+
+#if defined(_WIN32) || defined(_ARGLESS_HAS_UNISTD)
+// candidates are written to fd one per line through a stack buffer
+template <_ARGLESS_CORE app_t app, typename char_t>
+	requires (sizeof(char_t) == 1)
+inline bool complete_fd(int argc, const char_t** argv, int fd = 1)
+{
+	char_t buffer[4096];
+	std::size_t used = 0;
+
+	bool handled = complete<app>(argc, argv, [&](const char_t* candidate) {
+		for (; *candidate; ++candidate)
+		{
+			if (used == sizeof(buffer)) _ARGLESS_CORE write_fd(fd, buffer, used), used = 0;
+			buffer[used++] = *candidate;
+		}
+		if (used == sizeof(buffer)) _ARGLESS_CORE write_fd(fd, buffer, used), used = 0;
+		buffer[used++] = '\n';
+	});
+
+	if (used)
+		_ARGLESS_CORE write_fd(fd, buffer, used);
+	return handled;
+}
+#endif
+
+_ARGLESS_END
@@ -1,36 +1,167 @@
 #pragma once
 #include "argless.hpp"
-#include <sstream>
+#include <string>
+#include <string_view>
 
+#if defined(_WIN32)
+#include <io.h>
+#elif __has_include(<unistd.h>)
+#include <unistd.h>
+#define _ARGLESS_HAS_UNISTD
+#endif
+
+_ARGLESS_CORE_BEGIN
+
+// writes chars [m_offset, m_offset + m_capacity) of the formatted text to m_out and counts all of them,
+// so text can be sized first and filled (or written in chunks) without allocation, also in constant evaluation
+template <typename char_t>
+struct help_writer
+{
+	char_t* m_out = nullptr;
+	std::size_t m_capacity = 0;
+	std::size_t m_offset = 0;
+	std::size_t m_size = 0;
+
+	inline constexpr void put(char_t c)
+	{
+		if (m_size >= m_offset && m_size - m_offset < m_capacity)
+			m_out[m_size - m_offset] = c;
+		++m_size;
+	}
+
+	inline constexpr help_writer& operator<<(const char_t* str)
+	{
+		for (; *str; ++str)
+			put(*str);
+		return *this;
+	}
+
+	inline constexpr help_writer& operator<<(char c)
+	{
+		put(static_cast<char_t>(c));
+		return *this;
+	}
+
+	inline constexpr help_writer& operator<<(std::size_t value)
+	{
+		char digits[20];
+		std::size_t count = 0;
+		do digits[count++] = static_cast<char>('0' + value % 10); while (value /= 10);
+		while (count)
+			put(static_cast<char_t>(digits[--count]));
+		return *this;
+	}
+};
+
+template <typename char_t>
+inline constexpr void help_error_write(help_writer<char_t>& out, const result_error<char_t>& error)
+{
+	auto or_null = [](const char_t* str) -> const char_t* { return str ? str : static_str<str_from<char_t, "null">()>.data(); };
+
+	out << str_from<char_t, "error type: ">();
+	switch (error.type())
+	{
+		case argless::result_error_type::none:;
+		case argless::result_error_type::unknown: out << str_from<char_t, "unknown">(); break;
+		case argless::result_error_type::stray_value: out << str_from<char_t, "stray_value">(); break;
+		case argless::result_error_type::ambiguous_arg_value: out << str_from<char_t, "ambiguous_arg_value">(); break;
+		case argless::result_error_type::invalid_arg_value: out << str_from<char_t, "invalid_arg_value">(); break;
+		case argless::result_error_type::missing_arg: out << str_from<char_t, "missing_arg">(); break;
+		case argless::result_error_type::conflicting_args: out << str_from<char_t, "conflicting_args">(); break;
+		case argless::result_error_type::missing_group_arg: out << str_from<char_t, "missing_group_arg">(); break;
+		case argless::result_error_type::incomplete_group: out << str_from<char_t, "incomplete_group">(); break;
+		case argless::result_error_type::ambiguous_arg: out << str_from<char_t, "ambiguous_arg">(); break;
+	}
+	out << '\n'
+
+		<< str_from<char_t, "\twhat type: ">() << or_null(error.what_type()) << '\n'
+		<< str_from<char_t, "\twhere: ">() << error.where() << '\n'
+		<< str_from<char_t, "\twhat arg: ">() << or_null(error.what_arg()) << '\n'
+		<< str_from<char_t, "\twhat arg type: ">() << or_null(error.what_arg_type()) << '\n'
+		<< str_from<char_t, "\twhere arg: ">() << error.where_arg() << '\n';
+
+	if (auto suggestion = error.suggestion())
+		out << str_from<char_t, "\tdid you mean: ">() << suggestion << '\n';
+}
+
+#if defined(_WIN32) || defined(_ARGLESS_HAS_UNISTD)
+// retries partial writes, returns false if write fails
+inline bool write_fd(int fd, const void* data, std::size_t size)
+{
+	for (std::size_t written = 0; written < size;)
+	{
+#if defined(_WIN32)
+		auto result = ::_write(fd, static_cast<const char*>(data) + written, static_cast<unsigned int>(size - written));
+#else
+		auto result = ::write(fd, static_cast<const char*>(data) + written, size - written);
+#endif
+		if (result <= 0) return false;
+		written += static_cast<std::size_t>(result);
+	}
+	return true;
+}
+#endif
+
+_ARGLESS_CORE_END
 _ARGLESS_BEGIN
 
 template <_ARGLESS_CORE app_t app, typename char_t>
-inline constexpr std::basic_string<char_t> help_error(const result_error<char_t>& error, int argc, const char_t** argv)
+inline std::basic_string<char_t> help_error(const result_error<char_t>& error, int argc, const char_t** argv)
 {
 	(void) argc;
 	(void) argv;
-	std::basic_stringstream<char_t> out;
 
-	out << "error type: ";
-	switch (error.type())
+	_ARGLESS_CORE help_writer<char_t> size;
+	_ARGLESS_CORE help_error_write(size, error);
+
+	std::basic_string<char_t> text(size.m_size, char_t());
+	_ARGLESS_CORE help_writer<char_t> out{ text.data(), text.size() };
+	_ARGLESS_CORE help_error_write(out, error);
+	return text;
+}
+
+// snprintf like: writes at most size - 1 chars and null terminator, returns length of the whole text
+template <_ARGLESS_CORE app_t app, typename char_t>
+inline constexpr std::size_t help_error(const result_error<char_t>& error, int argc, const char_t** argv, char_t* buffer, std::size_t size)
+{
+	(void) argc;
+	(void) argv;
+
+	_ARGLESS_CORE help_writer<char_t> out{ buffer, size ? size - 1 : 0 };
+	_ARGLESS_CORE help_error_write(out, error);
+	if (size)
+		buffer[out.m_size < size - 1 ? out.m_size : size - 1] = char_t();
+	return out.m_size;
+}
+
+#if defined(_WIN32) || defined(_ARGLESS_HAS_UNISTD)
+// formats through a stack buffer straight to fd, no allocation, returns false if write fails
+template <_ARGLESS_CORE app_t app, typename char_t>
+	requires (sizeof(char_t) == 1)
+inline bool help_error_fd(const result_error<char_t>& error, int argc, const char_t** argv, int fd)
+{
+	(void) argc;
+	(void) argv;
+
+	char_t buffer[256];
+	std::size_t offset = 0;
+	while (true)
 	{
-		case argless::result_error_type::none:;
-		case argless::result_error_type::unknown: out << "unknown"; break;
-		case argless::result_error_type::stray_value: out << "stray_value"; break;
-		case argless::result_error_type::ambiguous_arg_value: out << "ambiguous_arg_value"; break;
-		case argless::result_error_type::invalid_arg_value: out << "invalid_arg_value"; break;
-		case argless::result_error_type::missing_arg: out << "missing_arg"; break;
-	}
-	out << '\n' 
+		_ARGLESS_CORE help_writer<char_t> out{ buffer, sizeof(buffer), offset };
+		_ARGLESS_CORE help_error_write(out, error);
 
-		<< "\twhat type: " << (error.what_type() ? error.what_type() : "null") << '\n'
-		<< "\twhere: " << error.where() << '\n'
-		<< "\twhat arg: " << (error.what_arg() ? error.what_arg() : "null") << '\n'
-		<< "\twhat arg type: " << (error.what_arg_type() ? error.what_arg_type() : "null") << '\n'
-		<< "\twhere arg: " << error.where_arg() << '\n';
+		std::size_t count = out.m_size - offset < sizeof(buffer) ? out.m_size - offset : sizeof(buffer);
+		if (!_ARGLESS_CORE write_fd(fd, buffer, count))
+			return false;
 
-	return out.str();
+		offset += count;
+		if (offset >= out.m_size) return true;
+	}
 }
+#endif
+
+_ARGLESS_END
+_ARGLESS_CORE_BEGIN
 
 /*
  * ARG::NAME \(ARGS::RQUIRED ? "(Required)" : "")    \t   Type: ARG::TYPE
@@ -38,13 +169,34 @@ inline constexpr std::basic_string<char_t> help_error(const result_error<char_t>
  *
  */
 
-template <_ARGLESS_CORE app_t app, typename char_t = char>
-inline std::basic_string<char_t> help_arg(const char_t* arg)
+template <typename t, typename char_t>
+inline constexpr void help_arg_write(help_writer<char_t>& out, bool indent)
 {
-	(void) arg;
-	std::basic_stringstream<char_t> out;
-	out << "TODO";
-	return out.str();
+	if (indent) out << '\t';
+	out << str_cast<char_t, t::name>();
+	if constexpr (!page_t<t>)
+		if constexpr (is_negatable<typename t::type>::value && is_long_name<t::name>)
+			out << str_from<char_t, ", ">() << str_cast<char_t, negated_name<t::name>()>();
+	if constexpr (!page_t<t>)
+		if constexpr (is_required<typename t::type>::value)
+			out << str_from<char_t, " (Required)">();
+
+	out << '\t' << str_from<char_t, "Type: ">();
+	if constexpr (page_t<t>)
+		out << str_from<char_t, "page">();
+	else
+		out << get_name<parse_cast<typename t::type>, char_t>();
+	out << '\n';
+
+	if constexpr (tetter_from<decltype(t::aliases)>::count || t::desc.size() > 1)
+	{
+		if (indent) out << '\t';
+		tetter_sequence<tetter_from<decltype(t::aliases)>::count>::invoke([&]<std::size_t i>(){
+			if constexpr (i) out << str_from<char_t, ", ">();
+			out << str_cast<char_t, std::get<i>(t::aliases)>();
+		});
+		out << '\t' << str_cast<char_t, t::desc>() << '\n';
+	}
 }
 
 /*
@@ -61,30 +213,148 @@ inline std::basic_string<char_t> help_arg(const char_t* arg)
  * \t ARG::NAME      \t   Type: ARG::TYPE
  * \t ARG::ALIASES   \t   ARG::DESC
  *
+ * Pages:
+ * \t PAGE::NAME     \t   Type: page
+ * \t                \t   PAGE::DESC
+ *
+ * Groups:
+ * \t GROUP::KIND: GROUP::NAMES
+ *
  */
 
-template <_ARGLESS_CORE app_t app, typename char_t = char>
-inline constexpr std::basic_string<char_t> help_app()
+template <typename app, typename char_t>
+inline constexpr void help_app_write(help_writer<char_t>& out)
 {
-	std::basic_stringstream<char_t> out;
+	using args = typename app::args;
+	using groups = typename app::groups;
 
-	out << _ARGLESS_CORE str_cast<char_t, app::name>() << '\n'; 
-	out << _ARGLESS_CORE str_cast<char_t, app::desc>() << '\n';
+	constexpr auto is_required_arg = []<typename t, std::size_t>() {
+		if constexpr (page_t<t>) return false;
+		else return is_required<typename t::type>::value;
+	};
+	constexpr auto is_other_arg = []<typename t, std::size_t>() {
+		if constexpr (page_t<t>) return false;
+		else return !is_required<typename t::type>::value;
+	};
 
-	app::args::invoke([&]<typename t>(){
-		out << '\n'; 
-		out << _ARGLESS_CORE str_cast<char_t, t::name>(); 
-		tetter_sequence<tetter_from<decltype(t::aliases)>::count>::invoke([&]<std::size_t i>(){
-			out << _ARGLESS_CORE str_from<char_t, ", ">() << _ARGLESS_CORE str_cast<char_t, std::get<i>(t::aliases)>(); 
+	using required_args = typename args::template filter_l<is_required_arg>;
+	using other_args = typename args::template filter_l<is_other_arg>;
+	using pages = typename args::template filter_l<[]<typename t, std::size_t>() { return page_t<t>; }>;
+
+	out << str_cast<char_t, app::name>() << '\n';
+	if constexpr (app::desc.size() > 1)
+		out << '\t' << str_cast<char_t, app::desc>() << '\n';
+
+	if constexpr (required_args::count)
+	{
+		out << '\n' << str_from<char_t, "Required:">() << '\n';
+		required_args::invoke([&]<typename t>() { help_arg_write<t>(out, true); });
+	}
+
+	if constexpr (other_args::count)
+	{
+		if constexpr (required_args::count)
+			out << '\n' << str_from<char_t, "Other:">() << '\n';
+		else
+			out << '\n' << str_from<char_t, "Args:">() << '\n';
+		other_args::invoke([&]<typename t>() { help_arg_write<t>(out, true); });
+	}
+
+	if constexpr (pages::count)
+	{
+		out << '\n' << str_from<char_t, "Pages:">() << '\n';
+		pages::invoke([&]<typename t>() { help_arg_write<t>(out, true); });
+	}
+
+	if constexpr (groups::count)
+	{
+		out << '\n' << str_from<char_t, "Groups:">() << '\n';
+		groups::invoke([&]<typename t>() {
+			out << '\t';
+			if constexpr (group_impl<t>::error == result_error_type::conflicting_args)
+				out << str_from<char_t, "exclusive: ">();
+			else if constexpr (group_impl<t>::error == result_error_type::missing_group_arg)
+				out << str_from<char_t, "at least one: ">();
+			else
+				out << str_from<char_t, "all or none: ">();
+			out << group_name<t, char_t> << '\n';
+		});
+	}
+}
+
+// whole help text as a static str (single write of rodata at runtime)
+template <typename app, typename char_t>
+constexpr inline auto help_app_str = [](){
+	constexpr std::size_t size = [](){ help_writer<char_t> out; help_app_write<app>(out); return out.m_size; }();
+	str<char_t, size + 1> text;
+	help_writer<char_t> out{ text.m_buffer, size };
+	help_app_write<app>(out);
+	return text;
+}();
+
+template <typename t, typename char_t>
+constexpr inline auto help_arg_str = [](){
+	constexpr std::size_t size = [](){ help_writer<char_t> out; help_arg_write<t>(out, false); return out.m_size; }();
+	str<char_t, size + 1> text;
+	help_writer<char_t> out{ text.m_buffer, size };
+	help_arg_write<t>(out, false);
+	return text;
+}();
+
+// "--no-" spelling of a long name or alias of a negatable arg
+template <typename app, typename t, typename char_t>
+inline constexpr bool help_negated(const char_t* arg)
+{
+	if constexpr (parse_impl<app>::template negatable_arg<t>)
+	{
+		bool found = false;
+		if constexpr (is_long_name<t::name>)
+			found = seq(static_str<str_cast<char_t, negated_name<t::name>()>()>.data(), arg);
+		tetter_sequence<tetter_from<decltype(t::aliases)>::count>::invoke([&]<std::size_t a>() {
+			if constexpr (is_long_name<std::get<a>(t::aliases)>)
+				found = found || seq(static_str<str_cast<char_t, negated_name<std::get<a>(t::aliases)>()>()>.data(), arg);
 		});
-		out << '\n' << "type: ";
-		out << get_name<_ARGLESS_CORE parse_cast<typename t::type>, char_t>();
-		out << '\n';
-		out << _ARGLESS_CORE str_cast<char_t, t::desc>();
-		out << '\n';
-	});
-
-	return out.str();
+		return found;
+	}
+	else
+		return false;
+}
+
+_ARGLESS_CORE_END
+_ARGLESS_BEGIN
+
+// views of the static help text, empty if arg is not a name, alias or "--no-" name of app args
+template <_ARGLESS_CORE app_t app, typename char_t = char>
+inline constexpr std::basic_string_view<char_t> help_arg_text(const char_t* arg)
+{
+	return app::args::invoke_pipe([&]<typename t>(std::basic_string_view<char_t> text) -> std::basic_string_view<char_t> {
+		if (!text.empty()) return text;
+		if (_ARGLESS_CORE seq(t::name.data(), arg) ||
+			tetter_sequence<tetter_from<decltype(t::aliases)>::count>::invoke_any([&]<std::size_t i>() {
+				return _ARGLESS_CORE seq(std::get<i>(t::aliases).data(), arg);
+			}) ||
+			_ARGLESS_CORE help_negated<app, t>(arg))
+			return { _ARGLESS_CORE help_arg_str<t, char_t>.data(), _ARGLESS_CORE help_arg_str<t, char_t>.size() - 1 };
+		return text;
+	}, std::basic_string_view<char_t>());
+}
+
+template <_ARGLESS_CORE app_t app, typename char_t = char>
+inline constexpr std::basic_string_view<char_t> help_app_text()
+{
+	return { _ARGLESS_CORE help_app_str<app, char_t>.data(), _ARGLESS_CORE help_app_str<app, char_t>.size() - 1 };
+}
+
+template <_ARGLESS_CORE app_t app, typename char_t = char>
+inline constexpr std::basic_string<char_t> help_arg(const char_t* arg)
+{
+	return std::basic_string<char_t>(help_arg_text<app, char_t>(arg));
+}
+
+template <_ARGLESS_CORE app_t app, typename char_t = char>
+inline constexpr std::basic_string<char_t> help_app()
+{
+	return std::basic_string<char_t>(help_app_text<app, char_t>());
 }
 
 _ARGLESS_END
@@ -115,11 +115,13 @@ struct args
 		std::size_t m_arg = 0;
 	};
 
+	inline args() {}
 	inline args(std::vector<arg>&& args) : m_args(std::move(args)), m_index(0), m_limit(m_args.size()), m_force(false) {}
 
 public:
 	constexpr inline const char_t* const* peak() const
 	{
+		if (m_index >= m_peaked) m_peaked = m_index + 1;
 		if (m_index < m_args.size() && m_index < m_limit && (!m_args[m_index].m_arg || m_force))
 			return &m_args[m_index].m_value;
 		return nullptr;
@@ -132,6 +134,29 @@ public:
 	size_t m_index = 0;
 	size_t m_limit = 0;
 	bool m_force = false;
+
+	// one past the furthest token peak() looked at, a parse gives the same result for every limit above it
+	mutable size_t m_peaked = 0;
+
+	// parse_known: unrecognized tokens are forwarded here instead of noname arg / stray_value
+	const char_t** m_rest = nullptr;
+	size_t m_rest_count = 0;
+
+	// index + 1 of a terminal arg (--help), parsing starts there and ends after it
+	size_t m_terminal = 0;
+
+	// index + 1 of "--", m_limit ends before it until the args before it are parsed
+	size_t m_marker = 0;
+};
+
+// values offered by shell completion
+template <typename char_t, std::size_t n>
+struct completion_list
+{
+	const char_t* m_values[n] = {};
+
+	inline constexpr const char_t* const* begin() const { return m_values; }
+	inline constexpr const char_t* const* end() const { return m_values + n; }
 };
 
 template <typename t>
@@ -147,6 +172,14 @@ struct parser
 
 	template <typename char_t>
 	static constexpr inline _ARGLESS_CORE str<char_t, x> name;
+
+	// optional
+	template <typename char_t>
+	static constexpr inline _ARGLESS_CORE completion_list<char_t, x> completions;
+
+	// optional, consumes what parse would without building the value, returns parse(args).is_valid_no_default()
+	template <typename char_t>
+	static inline bool skip(args<char_t>& args);
 	*/
 };
 
@@ -159,6 +192,16 @@ struct parser<void>
 	static constexpr inline auto name = str_from<char_t, "<>">();
 };
 
+// skips a value which is not used (repeated args), parses and drops it when parser<t> has no skip
+template <typename t, typename char_t>
+inline bool parse_skip(args<char_t>& args)
+{
+	if constexpr (requires { parser<t>::template skip<char_t>(args); })
+		return parser<t>::template skip<char_t>(args);
+	else
+		return parser<t>::template parse<char_t>(args).is_valid_no_default();
+}
+
 _ARGLESS_CORE_END
 _ARGLESS_BEGIN
 
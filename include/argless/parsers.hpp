@@ -12,6 +12,7 @@
 #define ARGLESS_STDH_OPTIONAL
 #define ARGLESS_STDH_VARIANT
 #define ARGLESS_STDH_TUPLE
+#define ARGLESS_STDH_THREAD
 #endif
 
 #include "parsers/fundamental_type.hpp"
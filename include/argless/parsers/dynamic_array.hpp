@@ -81,6 +81,15 @@ struct parser<t<t_t, t_st>>
 			return value;
 	}
 
+	template <typename char_t>
+	static inline bool skip(args<char_t>& args)
+	{
+		bool any = false;
+		while (parse_skip<t_t>(args))
+			any = true;
+		return any;
+	}
+
 	template <typename char_t>
 	static constexpr inline auto name = array_wrap_name<type_name<t_t, char_t>()>() + str_from<char_t, "[]">();
 };
@@ -112,6 +121,15 @@ struct parser<std::forward_list<t_t, t_st>>
 			return value;
 	}
 
+	template <typename char_t>
+	static inline bool skip(args<char_t>& args)
+	{
+		bool any = false;
+		while (parse_skip<t_t>(args))
+			any = true;
+		return any;
+	}
+
 	template <typename char_t>
 	static constexpr inline auto name = array_wrap_name<type_name<t_t, char_t>()>() + str_from<char_t, "[]">();
 };
@@ -149,6 +149,13 @@ struct parser<enum_t>
 		else
 			return str();
 	}();
+
+	template <typename char_t>
+	static constexpr inline auto completions = [](){
+		completion_list<char_t, vs::count> values;
+		vs::invoke([&]<typename t, std::size_t i>() { values.m_values[i] = static_str<str_cast<char_t, t::name>()>.data(); });
+		return values;
+	}();
 };
 
 _ARGLESS_CORE_END
@@ -26,6 +26,9 @@ struct parser<bool>
 
 	template <typename char_t>
 	static constexpr inline auto name = str_from<char_t, "boolean">();
+
+	template <typename char_t>
+	static constexpr inline completion_list<char_t, 2> completions = { static_str<str_from<char_t, "true">()>.data(), static_str<str_from<char_t, "false">()>.data() };
 };
 
 template <typename t>
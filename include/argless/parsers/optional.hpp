@@ -25,6 +25,10 @@ struct parser<std::optional<opt_t>>
 
 	template <typename char_t>
 	static constexpr inline auto name = optional_name<type_name<opt_t, char_t>()>();
+
+	template <typename char_t>
+		requires requires { parser<opt_t>::template completions<char_t>; }
+	static constexpr inline auto completions = parser<opt_t>::template completions<char_t>;
 };
 
 _ARGLESS_CORE_END
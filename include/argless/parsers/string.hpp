@@ -36,6 +36,14 @@ struct parser<std::basic_string<str_char, str_traits, str_alloc>>
 		}
 	}
 
+	template <typename char_t>
+	static inline bool skip(args<char_t>& args)
+	{
+		if (!args.peak())
+			return false;
+		return args.consume(), true;
+	}
+
 	template <typename char_t>
 	static constexpr inline auto name = str_from<char, "text">();
 };
@@ -3,6 +3,7 @@
 
 #if defined(ARGLESS_STDH_TUPLE) || defined(_GLIBCXX_TUPLE) || defined(_LIBCPP_TUPLE) || defined(_TUPLE_)
 
+#include <algorithm>
 #include <tuple>
 
 _ARGLESS_CORE_BEGIN
@@ -15,33 +16,88 @@ struct parser<std::tuple<tup_t, tup_st, tup_ts...>>
 	template <typename char_t>
 	static inline parse_result<type, char_t> parse(args<char_t>& args)
 	{
+		using rest_t = std::tuple<tup_st, tup_ts...>;
+
 		const auto from = args.m_index; 
 		const auto to = args.m_limit;
-
-		for (size_t l = args.m_limit; l >= from; --l)
+		auto peaked = args.m_peaked;
+
+		// the rest fails from every start in [scan, l], valid is the start below them when it parses there (none if not known),
+		// when the first element read up to its limit (the limit goes down one at a time) starts below are checked with as much
+		// work as it took, so a first element reading many tokens in front of a rest which never parses gives up in linear time
+		const auto none = to + 1;
+		auto scan = to + 1;
+		auto valid = none;
+		size_t scan_peaked = 0;
+
+		// limits from the end down, a limit is only tried when the first element looked at the token it cuts off
+		for (size_t l = to + 1; l-- > from;)
 		{
+			if (scan > l + 1)
+			{
+				scan = l + 1;
+				valid = none;
+			}
+
 			args.m_index = from;
 			args.m_limit = l;
+			args.m_peaked = 0;
 
 			auto result = parser<tup_t>::parse(args);
 
-			if (!result.is_valid())
-				continue;
-
-			args.m_limit = to;
-			auto rest_result = parser<std::tuple<tup_st, tup_ts...>>::parse(args);
-
-			if (!rest_result.is_valid())
-				continue;
-
-			if (result.is_default() && rest_result.is_default())
-				return make_default(std::tuple_cat(std::make_tuple(std::move(result.get())), std::move(rest_result.get())));
-			else
-				return std::tuple_cat(std::make_tuple(std::move(result.get())), std::move(rest_result.get()));
+			const auto end = args.m_index;
+			const auto first_peaked = args.m_peaked;
+			peaked = std::max(peaked, first_peaked);
+
+			if (result.is_valid())
+			{
+				args.m_limit = to;
+				auto rest_result = parser<rest_t>::parse(args);
+				peaked = std::max(peaked, args.m_peaked);
+
+				if (rest_result.is_valid())
+				{
+					args.m_peaked = peaked;
+					if (result.is_default() && rest_result.is_default())
+						return make_default(std::tuple_cat(std::make_tuple(std::move(result.get())), std::move(rest_result.get())));
+					else
+						return std::tuple_cat(std::make_tuple(std::move(result.get())), std::move(rest_result.get()));
+				}
+
+				if (end + 1 == scan)
+					scan = end;
+			}
+
+			if (first_peaked > l)
+			{
+				for (auto work = l + 1 - from; valid == none && scan > from && work;)
+				{
+					const auto start = scan - 1;
+					args.m_index = start;
+					args.m_limit = to;
+					args.m_peaked = 0;
+					if (parser<rest_t>::parse(args).is_valid())
+						valid = start;
+					else
+						scan = start;
+					scan_peaked = std::max(scan_peaked, args.m_peaked);
+					work -= std::min(work, std::max(args.m_peaked, start + 1) - start);
+				}
+			}
+
+			// no start left for the rest, the checks stand in for the parses of it the lower limits would make
+			if (scan == from)
+			{
+				peaked = std::max(peaked, scan_peaked);
+				break;
+			}
+
+			l = std::min(l, first_peaked);
 		}
 
 		args.m_index = from;
 		args.m_limit = to;
+		args.m_peaked = peaked;
 		return make_expected<type>;
 	}
 
@@ -4,6 +4,8 @@
 #include <type_traits>
 #include <optional>
 #include <utility>
+#include <cstdint>
+#include <limits>
 
 _ARGLESS_CORE_BEGIN
 
@@ -94,6 +96,111 @@ inline constexpr bool seq(const l_char_t* lstr, const r_char_t* rstr)
 	}
 }
 
+// bit-parallel levenshtein distance (Myers, global variant by Hyyro), pattern is limited to 64 chars
+template <typename char_t>
+struct edit_pattern
+{
+	static constexpr inline std::size_t max_size = 64;
+
+	inline constexpr edit_pattern(const char_t* pattern) : m_pattern(pattern), m_size(slen(pattern))
+	{
+		if constexpr (sizeof(char_t) == 1)
+			for (std::size_t i = 0; i < m_size && i < max_size; ++i)
+				m_peq[static_cast<unsigned char>(pattern[i])] |= std::uint64_t(1) << i;
+	}
+
+	inline constexpr bool valid() const { return m_size && m_size <= max_size; }
+
+	inline constexpr std::uint64_t eq(char_t c) const
+	{
+		if constexpr (sizeof(char_t) == 1)
+			return m_peq[static_cast<unsigned char>(c)];
+		else
+		{
+			std::uint64_t mask = 0;
+			for (std::size_t i = 0; i < m_size; ++i)
+				if (m_pattern[i] == c) mask |= std::uint64_t(1) << i;
+			return mask;
+		}
+	}
+
+	// one pass over text, O(text_size) word operations
+	inline constexpr std::size_t distance(const char_t* text, std::size_t text_size) const
+	{
+		const std::uint64_t high = std::uint64_t(1) << (m_size - 1);
+		std::uint64_t pv = ~std::uint64_t(0);
+		std::uint64_t mv = 0;
+		std::size_t score = m_size;
+
+		for (std::size_t i = 0; i < text_size; ++i)
+		{
+			std::uint64_t eq = this->eq(text[i]);
+			std::uint64_t xv = eq | mv;
+			std::uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+			std::uint64_t ph = mv | ~(xh | pv);
+			std::uint64_t mh = pv & xh;
+
+			if (ph & high) ++score;
+			else if (mh & high) --score;
+
+			ph = (ph << 1) | 1;
+			mh <<= 1;
+			pv = mh | ~(xv | ph);
+			mv = ph & xv;
+		}
+
+		return score;
+	}
+
+	const char_t* m_pattern;
+	std::size_t m_size;
+	std::uint64_t m_peq[sizeof(char_t) == 1 ? 256 : 1] = {};
+};
+
+template <typename l_char_t, typename r_char_t>
+inline constexpr int scmp(const l_char_t* lstr, const r_char_t* rstr)
+{
+	for (;; ++lstr, ++rstr)
+	{
+		auto l = static_cast<char32_t>(*lstr);
+		auto r = static_cast<char32_t>(*rstr);
+		if (l != r) return l < r ? -1 : 1;
+		if (!l) return 0;
+	}
+}
+
+// rstr is a view of n chars (not null terminated)
+template <typename l_char_t, typename r_char_t>
+inline constexpr bool seq_n(const l_char_t* lstr, const r_char_t* rstr, std::size_t n)
+{
+	for (std::size_t i = 0; i < n; ++i)
+		if (!lstr[i] || static_cast<char32_t>(lstr[i]) != static_cast<char32_t>(rstr[i]))
+			return false;
+	return !lstr[n];
+}
+
+// compares the first n chars of lstr with rstr (a view of n chars), 0 when lstr starts with rstr
+template <typename l_char_t, typename r_char_t>
+inline constexpr int scmp_n(const l_char_t* lstr, const r_char_t* rstr, std::size_t n)
+{
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		auto l = static_cast<char32_t>(lstr[i]);
+		auto r = static_cast<char32_t>(rstr[i]);
+		if (l != r) return l < r ? -1 : 1;
+	}
+	return 0;
+}
+
+template <typename l_char_t, typename r_char_t>
+inline constexpr bool sprefix(const l_char_t* prefix, const r_char_t* str)
+{
+	for (; *prefix; ++prefix, ++str)
+		if (static_cast<char32_t>(*prefix) != static_cast<char32_t>(*str))
+			return false;
+	return true;
+}
+
 template <typename t, typename char_t>
 inline constexpr std::optional<t> stot(const char_t* str)
 {
@@ -149,13 +256,18 @@ inline constexpr std::optional<t> stot(const char_t* str)
 				continue;
 			}
 
-		auto old_result = result;
-
-		result *= 10;
-		result += d;
-
-		if (result < old_result)
-			return std::nullopt;
+		if constexpr (std::is_integral_v<t>)
+		{
+			// checked before it happens, signed overflow is undefined
+			if (result > (std::numeric_limits<t>::max() - d) / 10)
+				return std::nullopt;
+			result = static_cast<t>(result * 10 + d);
+		}
+		else
+		{
+			result *= 10;
+			result += d;
+		}
 	}
 
 	if (!at_least_one)
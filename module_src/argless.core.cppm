@@ -0,0 +1,50 @@
+module;
+// core headers only when the sources are used, the single header has no parts to pick
+#if __has_include(<argless/parser.hpp>)
+#include <argless/parser.hpp>
+#else
+#include <argless.hpp>
+#endif
+export module argless.core;
+
+// str, parser protocol and names, everything a custom argless::core::parser specialization needs
+
+export _ARGLESS_BEGIN
+
+using _ARGLESS get_name;
+
+_ARGLESS_END
+
+export _ARGLESS_CORE_BEGIN
+
+using _ARGLESS_CORE parser;
+using _ARGLESS_CORE args;
+using _ARGLESS_CORE parse_result;
+using _ARGLESS_CORE parse_skip;
+using _ARGLESS_CORE expected;
+using _ARGLESS_CORE completion_list;
+using _ARGLESS_CORE make_default;
+using _ARGLESS_CORE make_expected;
+
+using _ARGLESS_CORE type_name;
+using _ARGLESS_CORE wrapped_name;
+using _ARGLESS_CORE optional_name;
+using _ARGLESS_CORE array_wrap_name;
+using _ARGLESS_CORE or_name;
+using _ARGLESS_CORE and_name;
+using _ARGLESS_CORE number_name; 
+
+using _ARGLESS_CORE str;
+using _ARGLESS_CORE str_from;
+using _ARGLESS_CORE str_cast;
+using _ARGLESS_CORE static_str;
+
+using _ARGLESS_CORE get_charu;
+
+using _ARGLESS_CORE seq;
+using _ARGLESS_CORE seq_n;
+using _ARGLESS_CORE seq_nocase;
+using _ARGLESS_CORE stot;
+using _ARGLESS_CORE slen;
+
+_ARGLESS_CORE_END
@@ -3,10 +3,20 @@ module;
 #include <argless.hpp>
 export module argless;
 
+// app, results, helpers and every parser family, re-exports argless.core
+
+export import argless.core;
+
 export _ARGLESS_BEGIN
 
 using _ARGLESS app;
 using _ARGLESS arg;
+using _ARGLESS page;
+
+using _ARGLESS exclusive;
+using _ARGLESS at_least_one;
+using _ARGLESS all_or_none;
+using _ARGLESS abbreviations;
 
 using _ARGLESS nodesc; 
 
@@ -14,9 +24,15 @@ using _ARGLESS result;
 using _ARGLESS result_error;
 using _ARGLESS result_error_type;
 
+using _ARGLESS parser_context;
+
 using _ARGLESS accumulate;
 using _ARGLESS required;
 using _ARGLESS default_value;
+using _ARGLESS negatable;
+using _ARGLESS repeat;
+using _ARGLESS repeat_policy;
+using _ARGLESS terminal;
 
 using _ARGLESS rename;
 using _ARGLESS force;
@@ -29,39 +45,16 @@ using _ARGLESS enum_value;
 using _ARGLESS enum_values;
 using _ARGLESS enum_refl;
 
-using _ARGLESS get_name;
-
 using _ARGLESS help_error;
+using _ARGLESS help_error_fd;
 using _ARGLESS help_arg;
 using _ARGLESS help_app;
+using _ARGLESS help_arg_text;
+using _ARGLESS help_app_text;
 
-_ARGLESS_END
-
-// TODO: move to argless.core;
-export _ARGLESS_CORE_BEGIN
+using _ARGLESS completion_shell;
+using _ARGLESS completion_script;
+using _ARGLESS complete;
+using _ARGLESS complete_fd;
 
-using _ARGLESS_CORE parser;
-using _ARGLESS_CORE args;
-using _ARGLESS_CORE make_default;
-using _ARGLESS_CORE make_expected;
-
-using _ARGLESS_CORE type_name;
-using _ARGLESS_CORE wrapped_name;
-using _ARGLESS_CORE optional_name;
-using _ARGLESS_CORE array_wrap_name;
-using _ARGLESS_CORE or_name;
-using _ARGLESS_CORE and_name;
-using _ARGLESS_CORE number_name; 
-
-using _ARGLESS_CORE str;
-using _ARGLESS_CORE str_from;
-using _ARGLESS_CORE str_cast;
-
-using _ARGLESS_CORE get_charu;
-
-using _ARGLESS_CORE seq;
-using _ARGLESS_CORE seq_nocase;
-using _ARGLESS_CORE stot;
-using _ARGLESS_CORE slen;
-
-_ARGLESS_CORE_END
+_ARGLESS_END
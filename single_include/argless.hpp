@@ -47,6 +47,8 @@ SOFTWARE.
 #include <type_traits>
 #include <optional>
 #include <utility>
+#include <cstdint>
+#include <limits>
 
 _ARGLESS_CORE_BEGIN
 
@@ -137,6 +139,111 @@ inline constexpr bool seq(const l_char_t* lstr, const r_char_t* rstr)
 	}
 }
 
+// bit-parallel levenshtein distance (Myers, global variant by Hyyro), pattern is limited to 64 chars
+template <typename char_t>
+struct edit_pattern
+{
+	static constexpr inline std::size_t max_size = 64;
+
+	inline constexpr edit_pattern(const char_t* pattern) : m_pattern(pattern), m_size(slen(pattern))
+	{
+		if constexpr (sizeof(char_t) == 1)
+			for (std::size_t i = 0; i < m_size && i < max_size; ++i)
+				m_peq[static_cast<unsigned char>(pattern[i])] |= std::uint64_t(1) << i;
+	}
+
+	inline constexpr bool valid() const { return m_size && m_size <= max_size; }
+
+	inline constexpr std::uint64_t eq(char_t c) const
+	{
+		if constexpr (sizeof(char_t) == 1)
+			return m_peq[static_cast<unsigned char>(c)];
+		else
+		{
+			std::uint64_t mask = 0;
+			for (std::size_t i = 0; i < m_size; ++i)
+				if (m_pattern[i] == c) mask |= std::uint64_t(1) << i;
+			return mask;
+		}
+	}
+
+	// one pass over text, O(text_size) word operations
+	inline constexpr std::size_t distance(const char_t* text, std::size_t text_size) const
+	{
+		const std::uint64_t high = std::uint64_t(1) << (m_size - 1);
+		std::uint64_t pv = ~std::uint64_t(0);
+		std::uint64_t mv = 0;
+		std::size_t score = m_size;
+
+		for (std::size_t i = 0; i < text_size; ++i)
+		{
+			std::uint64_t eq = this->eq(text[i]);
+			std::uint64_t xv = eq | mv;
+			std::uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+			std::uint64_t ph = mv | ~(xh | pv);
+			std::uint64_t mh = pv & xh;
+
+			if (ph & high) ++score;
+			else if (mh & high) --score;
+
+			ph = (ph << 1) | 1;
+			mh <<= 1;
+			pv = mh | ~(xv | ph);
+			mv = ph & xv;
+		}
+
+		return score;
+	}
+
+	const char_t* m_pattern;
+	std::size_t m_size;
+	std::uint64_t m_peq[sizeof(char_t) == 1 ? 256 : 1] = {};
+};
+
+template <typename l_char_t, typename r_char_t>
+inline constexpr int scmp(const l_char_t* lstr, const r_char_t* rstr)
+{
+	for (;; ++lstr, ++rstr)
+	{
+		auto l = static_cast<char32_t>(*lstr);
+		auto r = static_cast<char32_t>(*rstr);
+		if (l != r) return l < r ? -1 : 1;
+		if (!l) return 0;
+	}
+}
+
+// rstr is a view of n chars (not null terminated)
+template <typename l_char_t, typename r_char_t>
+inline constexpr bool seq_n(const l_char_t* lstr, const r_char_t* rstr, std::size_t n)
+{
+	for (std::size_t i = 0; i < n; ++i)
+		if (!lstr[i] || static_cast<char32_t>(lstr[i]) != static_cast<char32_t>(rstr[i]))
+			return false;
+	return !lstr[n];
+}
+
+// compares the first n chars of lstr with rstr (a view of n chars), 0 when lstr starts with rstr
+template <typename l_char_t, typename r_char_t>
+inline constexpr int scmp_n(const l_char_t* lstr, const r_char_t* rstr, std::size_t n)
+{
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		auto l = static_cast<char32_t>(lstr[i]);
+		auto r = static_cast<char32_t>(rstr[i]);
+		if (l != r) return l < r ? -1 : 1;
+	}
+	return 0;
+}
+
+template <typename l_char_t, typename r_char_t>
+inline constexpr bool sprefix(const l_char_t* prefix, const r_char_t* str)
+{
+	for (; *prefix; ++prefix, ++str)
+		if (static_cast<char32_t>(*prefix) != static_cast<char32_t>(*str))
+			return false;
+	return true;
+}
+
 template <typename t, typename char_t>
 inline constexpr std::optional<t> stot(const char_t* str)
 {
@@ -192,13 +299,18 @@ inline constexpr std::optional<t> stot(const char_t* str)
 				continue;
 			}
 
-		auto old_result = result;
-
-		result *= 10;
-		result += d;
-
-		if (result < old_result)
-			return std::nullopt;
+		if constexpr (std::is_integral_v<t>)
+		{
+			// checked before it happens, signed overflow is undefined
+			if (result > (std::numeric_limits<t>::max() - d) / 10)
+				return std::nullopt;
+			result = static_cast<t>(result * 10 + d);
+		}
+		else
+		{
+			result *= 10;
+			result += d;
+		}
 	}
 
 	if (!at_least_one)
@@ -2161,11 +2273,13 @@ struct args
 		std::size_t m_arg = 0;
 	};
 
+	inline args() {}
 	inline args(std::vector<arg>&& args) : m_args(std::move(args)), m_index(0), m_limit(m_args.size()), m_force(false) {}
 
 public:
 	constexpr inline const char_t* const* peak() const
 	{
+		if (m_index >= m_peaked) m_peaked = m_index + 1;
 		if (m_index < m_args.size() && m_index < m_limit && (!m_args[m_index].m_arg || m_force))
 			return &m_args[m_index].m_value;
 		return nullptr;
@@ -2178,6 +2292,29 @@ public:
 	size_t m_index = 0;
 	size_t m_limit = 0;
 	bool m_force = false;
+
+	// one past the furthest token peak() looked at, a parse gives the same result for every limit above it
+	mutable size_t m_peaked = 0;
+
+	// parse_known: unrecognized tokens are forwarded here instead of noname arg / stray_value
+	const char_t** m_rest = nullptr;
+	size_t m_rest_count = 0;
+
+	// index + 1 of a terminal arg (--help), parsing starts there and ends after it
+	size_t m_terminal = 0;
+
+	// index + 1 of "--", m_limit ends before it until the args before it are parsed
+	size_t m_marker = 0;
+};
+
+// values offered by shell completion
+template <typename char_t, std::size_t n>
+struct completion_list
+{
+	const char_t* m_values[n] = {};
+
+	inline constexpr const char_t* const* begin() const { return m_values; }
+	inline constexpr const char_t* const* end() const { return m_values + n; }
 };
 
 template <typename t>
@@ -2193,6 +2330,14 @@ struct parser
 
 	template <typename char_t>
 	static constexpr inline _ARGLESS_CORE str<char_t, x> name;
+
+	// optional
+	template <typename char_t>
+	static constexpr inline _ARGLESS_CORE completion_list<char_t, x> completions;
+
+	// optional, consumes what parse would without building the value, returns parse(args).is_valid_no_default()
+	template <typename char_t>
+	static inline bool skip(args<char_t>& args);
 	*/
 };
 
@@ -2205,6 +2350,16 @@ struct parser<void>
 	static constexpr inline auto name = str_from<char_t, "<>">();
 };
 
+// skips a value which is not used (repeated args), parses and drops it when parser<t> has no skip
+template <typename t, typename char_t>
+inline bool parse_skip(args<char_t>& args)
+{
+	if constexpr (requires { parser<t>::template skip<char_t>(args); })
+		return parser<t>::template skip<char_t>(args);
+	else
+		return parser<t>::template parse<char_t>(args).is_valid_no_default();
+}
+
 _ARGLESS_CORE_END
 _ARGLESS_BEGIN
 
@@ -2344,6 +2499,11 @@ _ARGLESS_CORE_END
 
 #include <optional>
 #include <vector>
+#include <tuple>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <iterator>
 #include <type_traits>
 
 _ARGLESS_CORE_BEGIN
@@ -2360,12 +2520,98 @@ concept containerable = std::is_default_constructible_v<t> && (std::is_void_v<t>
 		requires (t c) { ++c; }
 	));
 
+// in place heap sort, constexpr and without <algorithm>
+template <typename t, typename less_t>
+inline constexpr void heap_sort(t* values, std::size_t size, less_t&& less)
+{
+	auto sift = [&](std::size_t root, std::size_t end) {
+		while (2 * root + 1 < end)
+		{
+			std::size_t child = 2 * root + 1;
+			if (child + 1 < end && less(values[child], values[child + 1])) ++child;
+			if (!less(values[root], values[child])) return;
+			std::swap(values[root], values[child]);
+			root = child;
+		}
+	};
+
+	for (std::size_t i = size / 2; i-- > 0;)
+		sift(i, size);
+	for (std::size_t end = size; end-- > 1;)
+	{
+		std::swap(values[0], values[end]);
+		sift(0, end);
+	}
+}
+
+// names copied as char32_t (so any char types compare) and sorted once,
+// collision checks and name lookups are O(n log n) constexpr work instead of pairwise template instantiations
+template <std::size_t count, std::size_t chars>
+struct name_set
+{
+	struct entry
+	{
+		std::size_t m_offset = 0;
+		std::size_t m_index = 0;
+	};
+
+	template <typename str_t>
+	inline constexpr void add(const str_t& name, std::size_t index = 0)
+	{
+		m_entries[m_size++] = { m_used, index };
+		for (std::size_t i = 0; i < name.size() && name.m_buffer[i]; ++i)
+			m_chars[m_used++] = static_cast<char32_t>(name.m_buffer[i]);
+		m_chars[m_used++] = 0;
+	}
+
+	inline constexpr const char32_t* at(const entry& e) const { return m_chars + e.m_offset; }
+
+	inline constexpr void sort()
+	{
+		heap_sort(m_entries, m_size, [&](const entry& l, const entry& r) { return scmp(at(l), at(r)) < 0; });
+	}
+
+	// sorted set only
+	inline constexpr bool unique() const
+	{
+		for (std::size_t i = 1; i < m_size; ++i)
+			if (!scmp(at(m_entries[i - 1]), at(m_entries[i])))
+				return false;
+		return true;
+	}
+
+	// sorted set only, index passed to add or not_found
+	template <typename char_t>
+	inline constexpr std::size_t find(const char_t* name, std::size_t not_found) const
+	{
+		std::size_t first = 0, last = m_size;
+		while (first < last)
+		{
+			std::size_t mid = first + (last - first) / 2;
+			int cmp = scmp(at(m_entries[mid]), name);
+			if (!cmp) return m_entries[mid].m_index;
+			if (cmp < 0) first = mid + 1;
+			else last = mid;
+		}
+		return not_found;
+	}
+
+	entry m_entries[count + 1] = {};
+	char32_t m_chars[chars + 1] = {};
+	std::size_t m_size = 0;
+	std::size_t m_used = 0;
+};
+
 template <typename... values>
-concept no_name_collision = tetter<values...>::template value_l<[]<typename t, std::size_t i>() {
-		return tetter<values...>::template pop_front_n<i + 1>::template value_l<[]<typename st, std::size_t>() {
-			return _ARGLESS_CORE seq(t::value.data(), st::value.data()); 
-		}>::any;
-	}>::none;
+constexpr inline bool names_unique = [](){
+	name_set<sizeof...(values), (values::value.size() + ... + 0)> set;
+	(set.add(values::value), ...);
+	set.sort();
+	return set.unique();
+}();
+
+template <typename... values>
+concept no_name_collision = names_unique<values...>;
 
 template <bool derivable, typename t>
 struct _derive_impl;
@@ -2438,6 +2684,28 @@ template <_ARGLESS_CORE parsable t, auto value_or_lambda>
 		std::is_convertible_v<decltype(value_or_lambda), typename _ARGLESS_CORE parser<t>::type>
 struct default_value { static constexpr inline auto value = value_or_lambda; };
 
+// what a repeated arg does, error reports ambiguous_arg_value
+enum class repeat_policy
+{
+	error,
+	first_wins,
+	last_wins,
+	merge, // appends values of container args
+};
+
+// arg<repeat<t, policy>, ...> is an arg of t, occurrences which do not win are skipped without building their value
+template <_ARGLESS_CORE parsable t, repeat_policy policy>
+struct repeat {};
+
+// arg<terminal<t>, ...> (--help, --version) stops parsing, when present only it and its value are parsed
+template <_ARGLESS_CORE parsable t>
+struct terminal {};
+
+// flag which also registers "--no-name" for its name and aliases starting with "--", result is unset/true/false
+template <_ARGLESS_CORE parsable t = void>
+	requires std::is_void_v<t> || std::is_same_v<t, bool>
+struct negatable {};
+
 
 template <_ARGLESS_CORE parsable t, _ARGLESS_CORE str new_name>
 struct rename : public _ARGLESS_CORE derive<t>
@@ -2509,6 +2777,26 @@ private:
 	std::size_t m_index = 0;
 };
 
+// arg groups, checked after the whole app/page is parsed
+
+// at most one of names
+template <_ARGLESS_CORE str... names>
+	requires (sizeof...(names) > 0) && _ARGLESS_CORE no_name_collision<std::integral_constant<decltype(names), names>...>
+struct exclusive {};
+
+// at least one of names
+template <_ARGLESS_CORE str... names>
+	requires (sizeof...(names) > 0) && _ARGLESS_CORE no_name_collision<std::integral_constant<decltype(names), names>...>
+struct at_least_one {};
+
+// none or all of names
+template <_ARGLESS_CORE str... names>
+	requires (sizeof...(names) > 0) && _ARGLESS_CORE no_name_collision<std::integral_constant<decltype(names), names>...>
+struct all_or_none {};
+
+// app/page setting: unambiguous prefix of a "--" name/alias selects its arg (--verb -> --verbose)
+struct abbreviations {};
+
 _ARGLESS_END
 
 
@@ -2545,6 +2833,12 @@ struct result_cast_impl<default_value<t, v>>
 	using type = std::optional<t>;
 };
 
+template <typename t>
+struct result_cast_impl<negatable<t>>
+{
+	using type = std::optional<bool>;
+};
+
 // result-type for non-parse types
 template <typename t>
 using result_cast = typename result_cast_impl<t>::type;
@@ -2578,6 +2872,12 @@ struct parse_cast_impl<default_value<t, v>>
 	using type = t;
 };
 
+template <typename t>
+struct parse_cast_impl<negatable<t>>
+{
+	using type = t;
+};
+
 // parsable-type for non-parse types
 template <typename t>
 using parse_cast = typename parse_cast_impl<t>::type;
@@ -2624,6 +2924,18 @@ struct result_insert<void>
 	}
 };
 
+template <typename t>
+struct result_insert<negatable<t>>
+{
+	// "--no-name" inserts false
+	static inline constexpr bool call(std::optional<bool>& result, bool value = true)
+	{
+		if (result) return false;
+		result = value;
+		return true;
+	}
+};
+
 template <typename c>
 struct result_insert<accumulate<void, c>>
 {
@@ -2638,6 +2950,43 @@ struct result_insert<accumulate<void, c>>
 	}
 };
 
+template <typename t>
+struct result_merge
+{
+	static inline constexpr bool call(result_cast<t>& result, parse_cast<t>&& value)
+	{
+		if (!result)
+			result = std::move(value);
+		else
+			result->insert(result->end(), std::make_move_iterator(value.begin()), std::make_move_iterator(value.end()));
+		return true;
+	}
+};
+
+// noname arg values after "--" are appended to the ones before it, for containers of values (not strings)
+template <typename t>
+concept continued_noname = requires (result_cast<t> result, parse_cast<t> value) { result->insert(result->end(), value.begin(), value.end()); } &&
+	!requires { typename parse_cast<t>::traits_type; };
+
+template <typename t>
+struct result_reset
+{
+	static inline constexpr void call(result_cast<t>& result) { result = result_cast<t>(); }
+};
+
+template <typename t, typename c>
+struct result_reset<accumulate<t, c>>
+{
+	// keeps container capacity for reused results
+	static inline constexpr void call(accumulate<t, c>& result)
+	{
+		if constexpr (requires (c r) { r.clear(); })
+			result.clear();
+		else
+			result = c();
+	}
+};
+
 template <typename t>
 struct result_get
 {
@@ -2664,134 +3013,340 @@ struct result_get<default_value<t, v>>
 	}
 };
 
-template <_ARGLESS_CORE str... names>
-struct result_find;
-
-template <_ARGLESS_CORE str name, _ARGLESS_CORE str... names>
-struct result_find<name, names...>
-{
-	static inline auto&& call(auto&& self)
-	{
-		using This = std::remove_cvref_t<decltype(self)>;
-		using Values = decltype([](){
-				if constexpr (requires { typename This::app; })
-					return typename This::app::args{};
-				else
-					return typename This::__todo_for_page{};
-			}());
-		static constexpr auto arg_index = [](){
-			return Values::template find_l<[]<typename t>() {
-				return _ARGLESS_CORE seq(t::name.data(), name.data()) ||
-					tetter_sequence<tetter_from<decltype(t::aliases)>::count>::template value_l<[]<std::size_t i>() {
-						return _ARGLESS_CORE seq(std::get<i>(t::aliases).data(), name.data());
-					}>::any; 
-			}>::index;
-		}();
-		static_assert(arg_index != Values::count, "missing arg name");
+_ARGLESS_CORE_END
+_ARGLESS_BEGIN
 
-		if constexpr (sizeof...(names))
-			return _ARGLESS_CORE result_get<typename Values::template get<arg_index>::type>::call(std::get<arg_index>(std::forward<decltype(self)>(self).m_values)).template get<names...>();
-		else
-			return _ARGLESS_CORE result_get<typename Values::template get<arg_index>::type>::call(std::get<arg_index>(std::forward<decltype(self)>(self).m_values).m_value);
-	}
-};
+template <_ARGLESS_CORE str, _ARGLESS_CORE str, _ARGLESS_CORE parsable, typename... args_>
+struct page;
 
-template <>
-struct result_find<>
-{
-	static inline auto&& call(auto&& self)
-	{
-		using This = std::remove_cvref_t<decltype(self)>;
-		return _ARGLESS_CORE result_get<typename This::app::noname_arg_type>::call(self.m_noname_value);
-	}
-};
+_ARGLESS_END
+_ARGLESS_CORE_BEGIN
 
 template <typename t>
-struct is_required : public std::false_type {};
+struct is_page : public std::false_type {};
 
-template <typename t>
-struct is_required<required<t>> : public std::true_type {};
+template <_ARGLESS_CORE str name, _ARGLESS_CORE str desc, _ARGLESS_CORE parsable noname_arg_type, typename... args_>
+struct is_page<page<name, desc, noname_arg_type, args_...>> : public std::true_type {};
 
 template <typename t>
-struct is_default_value : public std::false_type {};
+concept page_t = is_page<t>::value;
 
-template <typename t, auto v>
-struct is_default_value<default_value<t, v>> : public std::true_type {};
+template <typename t>
+struct is_group : public std::false_type {};
 
-template <typename... args>
-concept no_name_or_alias_collision = (tetter<args...>::template map_l<
-		[]<typename t, std::size_t>() -> typename tetter<std::integral_constant<decltype(t::name), t::name>>::template join<
-			typename tetter_sequence<tetter_from<decltype(t::aliases)>::count>::template map_l<
-				[]<std::size_t i>() -> std::integral_constant<decltype(std::get<i>(t::aliases)), std::get<i>(t::aliases)> {}
-			>
-		> {}
-	>::concat_a::template value_l<[]<typename t, std::size_t i, typename... ts>() {
-		return tetter<ts...>::template pop_front_n<i + 1>::template value_l<[]<typename st>() {
-			return _ARGLESS_CORE seq(t::value.data(), st::value.data()); 
-		}>::any;
-	}>::none);
+template <_ARGLESS_CORE str... names>
+struct is_group<exclusive<names...>> : public std::true_type {};
 
-_ARGLESS_CORE_END
-_ARGLESS_BEGIN
+template <_ARGLESS_CORE str... names>
+struct is_group<at_least_one<names...>> : public std::true_type {};
 
-template <_ARGLESS_CORE parsable, _ARGLESS_CORE str, _ARGLESS_CORE str, _ARGLESS_CORE str...>
-struct arg;
+template <_ARGLESS_CORE str... names>
+struct is_group<all_or_none<names...>> : public std::true_type {};
 
-_ARGLESS_END
-_ARGLESS_CORE_BEGIN
+template <typename t>
+concept group_t = is_group<t>::value;
 
 template <typename t>
-struct is_arg : public std::false_type {};
+struct is_setting : public std::false_type {};
 
-template <typename t, _ARGLESS_CORE str name, _ARGLESS_CORE str desc, _ARGLESS_CORE str... aliases>
-struct is_arg<arg<t, name, desc, aliases...>> : public std::true_type {};
+template <>
+struct is_setting<abbreviations> : public std::true_type {};
 
 template <typename t>
-concept arg_t = is_arg<t>::value;
+concept setting_t = is_setting<t>::value;
 
 template <typename t>
-concept opt_arg_t = is_arg<t>::value || std::is_same<t, void>::value;
+struct is_required : public std::false_type {};
 
-_ARGLESS_CORE_END
-_ARGLESS_BEGIN
+template <typename t>
+struct is_required<required<t>> : public std::true_type {};
 
-template <_ARGLESS_CORE str, _ARGLESS_CORE str, _ARGLESS_CORE parsable, _ARGLESS_CORE arg_t... args_>
-	requires _ARGLESS_CORE no_name_or_alias_collision<args_...>
-struct app;
+template <typename t>
+struct is_default_value : public std::false_type {};
 
-_ARGLESS_END
-_ARGLESS_CORE_BEGIN
+template <typename t, auto v>
+struct is_default_value<default_value<t, v>> : public std::true_type {};
 
 template <typename t>
-struct is_app : public std::false_type {};
+struct attribute_cast_impl
+{
+	using type = t;
+	static constexpr inline auto policy = repeat_policy::error;
+	static constexpr inline bool terminal = false;
+};
 
-template <_ARGLESS_CORE str name, _ARGLESS_CORE str desc, _ARGLESS_CORE parsable noname_arg_type, _ARGLESS_CORE arg_t... args_>
-struct is_app<app<name, desc, noname_arg_type, args_...>> : public std::true_type {};
+template <typename t, repeat_policy policy_>
+struct attribute_cast_impl<repeat<t, policy_>> : public attribute_cast_impl<t>
+{
+	static constexpr inline auto policy = policy_;
+};
 
 template <typename t>
-concept app_t = is_app<t>::value;
+struct attribute_cast_impl<terminal<t>> : public attribute_cast_impl<t>
+{
+	static constexpr inline bool terminal = true;
+};
 
-_ARGLESS_CORE_END
+// arg type without attributes (repeat, terminal)
+template <typename t>
+using attribute_cast = typename attribute_cast_impl<t>::type;
 
+template <typename t>
+struct is_negatable : public std::false_type {};
 
+template <typename t>
+struct is_negatable<negatable<t>> : public std::true_type {};
 
+template <_ARGLESS_CORE str name>
+constexpr inline bool is_long_name = name.size() > 3 && name.m_buffer[0] == '-' && name.m_buffer[1] == '-';
 
+// "--name" -> "--no-name"
+template <_ARGLESS_CORE str name>
+	requires is_long_name<name>
+inline consteval auto negated_name()
+{
+	using char_t = typename decltype(name)::char_t;
+	str<char_t, name.size() - 2> rest;
+	for (std::size_t i = 0; i < rest.size(); ++i)
+		rest.m_buffer[i] = name.m_buffer[i + 2];
+	return str_from<char_t, "--no-">() + rest;
+}
 
+// names, aliases and generated "--no-" names of an app/page element
+template <typename t>
+struct element_names
+{
+	static constexpr inline std::size_t count = 0;
+	static constexpr inline std::size_t chars = 0;
 
+	template <typename set_t>
+	static inline constexpr void add(set_t&, std::size_t, bool) {}
+};
 
+template <typename t>
+	requires requires { t::name; t::aliases; }
+struct element_names<t>
+{
+	static constexpr inline bool negatable = [](){
+		if constexpr (page_t<t>) return false;
+		else return is_negatable<typename t::type>::value;
+	}();
 
+	template <auto name>
+	static constexpr inline std::size_t negated_chars = negatable && is_long_name<name> ? name.size() + 3 : 0;
 
+	static constexpr inline std::size_t alias_count = tetter_from<decltype(t::aliases)>::count;
 
+	static constexpr inline std::size_t count = [](){
+		std::size_t count = 1 + alias_count;
+		if constexpr (negatable)
+		{
+			count += is_long_name<t::name>;
+			tetter_sequence<alias_count>::invoke([&]<std::size_t a>() { count += is_long_name<std::get<a>(t::aliases)>; });
+		}
+		return count;
+	}();
 
-_ARGLESS_BEGIN
+	static constexpr inline std::size_t chars = [](){
+		std::size_t chars = t::name.size() + negated_chars<t::name>;
+		tetter_sequence<alias_count>::invoke([&]<std::size_t a>() { chars += std::get<a>(t::aliases).size() + negated_chars<std::get<a>(t::aliases)>; });
+		return chars;
+	}();
+
+	template <typename set_t>
+	static inline constexpr void add(set_t& set, std::size_t index, bool negated)
+	{
+		set.add(t::name, index);
+		tetter_sequence<alias_count>::invoke([&]<std::size_t a>() { set.add(std::get<a>(t::aliases), index); });
+
+		if constexpr (negatable)
+			if (negated)
+			{
+				if constexpr (is_long_name<t::name>)
+					set.add(negated_name<t::name>(), index);
+				tetter_sequence<alias_count>::invoke([&]<std::size_t a>() {
+					if constexpr (is_long_name<std::get<a>(t::aliases)>)
+						set.add(negated_name<std::get<a>(t::aliases)>(), index);
+				});
+			}
+	}
+};
+
+template <typename... args>
+constexpr inline bool names_and_aliases_unique = [](){
+	name_set<(element_names<args>::count + ... + 0), (element_names<args>::chars + ... + 0)> set;
+	(element_names<args>::add(set, 0, true), ...);
+	set.sort();
+	return set.unique();
+}();
+
+template <typename... args>
+concept no_name_or_alias_collision = names_and_aliases_unique<args...>;
+
+// sorted names and aliases of app/page args (tetter) to their index, shared by every result.get<>
+template <typename values>
+constexpr inline auto name_index = [](){
+	constexpr auto sizes = [](){
+		std::size_t count = 0, chars = 0;
+		values::invoke([&]<typename t, std::size_t>() { count += 1 + tetter_from<decltype(t::aliases)>::count; chars += element_names<t>::chars; });
+		return std::make_pair(count, chars);
+	}();
+
+	name_set<sizes.first, sizes.second> set;
+	values::invoke([&]<typename t, std::size_t i>() { element_names<t>::add(set, i, false); });
+	set.sort();
+	return set;
+}();
+
+// looked up once per app and name, not per result type or get overload
+template <typename values, _ARGLESS_CORE str name>
+constexpr inline std::size_t arg_index = name_index<values>.find(name.data(), values::count);
+
+template <_ARGLESS_CORE str... names>
+struct result_find;
+
+template <_ARGLESS_CORE str name, _ARGLESS_CORE str... names>
+struct result_find<name, names...>
+{
+	static inline auto&& call(auto&& self)
+	{
+		using This = std::remove_cvref_t<decltype(self)>;
+		using Values = typename This::app::args;
+		constexpr auto index = arg_index<Values, name>;
+		if constexpr (index == Values::count)
+			static_assert(index != Values::count, "missing arg name");
+		else
+		{
+			// element type of the value tuple, without walking the arg list
+			using arg = std::remove_cvref_t<decltype(std::get<index>(self.m_values))>;
+			if constexpr (_ARGLESS_CORE page_t<arg>)
+			{
+				if constexpr (sizeof...(names))
+					return std::get<index>(std::forward<decltype(self)>(self).m_values).template get<names...>();
+				else
+					return std::get<index>(std::forward<decltype(self)>(self).m_values);
+			}
+			else
+			{
+				static_assert(!sizeof...(names), "only pages have nested arg names");
+				return _ARGLESS_CORE result_get<typename arg::type>::call(std::get<index>(std::forward<decltype(self)>(self).m_values).m_value);
+			}
+		}
+	}
+};
+
+template <>
+struct result_find<>
+{
+	static inline auto&& call(auto&& self)
+	{
+		using This = std::remove_cvref_t<decltype(self)>;
+		return _ARGLESS_CORE result_get<typename This::app::noname_arg_type>::call(self.m_noname_value);
+	}
+};
+
+_ARGLESS_CORE_END
+_ARGLESS_BEGIN
+
+template <_ARGLESS_CORE parsable, _ARGLESS_CORE str, _ARGLESS_CORE str, _ARGLESS_CORE str...>
+struct arg;
+
+_ARGLESS_END
+_ARGLESS_CORE_BEGIN
+
+template <typename t>
+struct is_arg : public std::false_type {};
+
+template <typename t, _ARGLESS_CORE str name, _ARGLESS_CORE str desc, _ARGLESS_CORE str... aliases>
+struct is_arg<arg<t, name, desc, aliases...>> : public std::true_type {};
+
+template <typename t>
+concept arg_t = is_arg<t>::value;
+
+template <typename t>
+concept opt_arg_t = is_arg<t>::value || std::is_same<t, void>::value;
+
+// element of app/page arg list
+template <typename t>
+concept app_arg_t = arg_t<t> || page_t<t> || group_t<t> || setting_t<t>;
+
+template <typename app_like>
+struct parse_impl;
+
+// type-erased parse core (ARGLESS_COMPACT_CORE), see compact.hpp
+template <typename char_t>
+struct compact_core;
+
+template <typename char_t>
+struct compact_state;
+
+template <typename app_like, typename char_t>
+struct compact_tables;
+
+_ARGLESS_CORE_END
+_ARGLESS_BEGIN
+
+template <_ARGLESS_CORE str, _ARGLESS_CORE str, _ARGLESS_CORE parsable, _ARGLESS_CORE app_arg_t... args_>
+	requires _ARGLESS_CORE no_name_or_alias_collision<args_...>
+struct app;
+
+_ARGLESS_END
+_ARGLESS_CORE_BEGIN
+
+template <typename t>
+struct is_app : public std::false_type {};
+
+template <_ARGLESS_CORE str name, _ARGLESS_CORE str desc, _ARGLESS_CORE parsable noname_arg_type, _ARGLESS_CORE app_arg_t... args_>
+struct is_app<app<name, desc, noname_arg_type, args_...>> : public std::true_type {};
+
+template <typename t>
+concept app_t = is_app<t>::value;
+
+_ARGLESS_CORE_END
+_ARGLESS_BEGIN
+
+template <_ARGLESS_CORE app_t, typename>
+struct parser_context;
+
+_ARGLESS_END
+_ARGLESS_CORE_BEGIN
+
+template <typename app, typename lines_t>
+struct batch
+{
+	static_assert(false, "batch parsing is not available (include <thread> before argless or define ARGLESS_STDH_THREAD) or lines_t is not a range of argv spans");
+};
+
+_ARGLESS_CORE_END
+
+
+
+
+
+
+
+
+
+
+
+_ARGLESS_BEGIN
 
 constexpr inline auto nodesc = _ARGLESS_CORE str("");
 
 template <_ARGLESS_CORE parsable type_, _ARGLESS_CORE str name_, _ARGLESS_CORE str desc_ = nodesc, _ARGLESS_CORE str... aliases_>
 struct arg
 {
+	static_assert(!_ARGLESS_CORE is_negatable<_ARGLESS_CORE attribute_cast<type_>>::value || _ARGLESS_CORE is_long_name<name_> || (_ARGLESS_CORE is_long_name<aliases_> || ...),
+		"negatable arg needs a name or alias starting with \"--\"");
+	static_assert(_ARGLESS_CORE attribute_cast_impl<type_>::policy != repeat_policy::merge ||
+		requires (_ARGLESS_CORE result_cast<_ARGLESS_CORE attribute_cast<type_>> result, _ARGLESS_CORE parse_cast<_ARGLESS_CORE attribute_cast<type_>> value) {
+			result->insert(result->end(), value.begin(), value.end());
+		}, "repeat_policy::merge needs a container arg type");
+
 public:
-	using type = type_;
+	using type = _ARGLESS_CORE attribute_cast<type_>;
+	static constexpr auto repeat = _ARGLESS_CORE attribute_cast_impl<type_>::policy;
+	static constexpr auto terminal = _ARGLESS_CORE attribute_cast_impl<type_>::terminal;
 	static constexpr auto name = name_;
 	static constexpr auto desc = desc_;
 	static constexpr auto aliases = std::make_tuple(aliases_...);
@@ -2800,9 +3355,8 @@ private:
 	template <_ARGLESS_CORE str...>
 	friend struct _ARGLESS_CORE result_find;
 
-	template <_ARGLESS_CORE str, _ARGLESS_CORE str, _ARGLESS_CORE parsable, _ARGLESS_CORE arg_t... args_>
-		requires _ARGLESS_CORE no_name_or_alias_collision<args_...>
-	friend struct app;
+	template <typename>
+	friend struct _ARGLESS_CORE parse_impl;
 
 	_ARGLESS_CORE result_cast<type> m_value;
 };
@@ -2816,6 +3370,10 @@ enum class result_error_type
 	ambiguous_arg_value,
 	invalid_arg_value,
 	missing_arg,
+	conflicting_args,
+	missing_group_arg,
+	incomplete_group,
+	ambiguous_arg,
 };
 
 template <typename char_t>
@@ -2835,10 +3393,15 @@ public:
 	inline constexpr std::size_t where() const { return m_index; }
 	inline constexpr const char_t* what_type() const { return m_expected_type; }
 
+	// closest arg/page name to the unrecognized token (stray_value, invalid_arg_value), computed on call
+	inline const char_t* suggestion() const { return m_suggest && m_value ? m_suggest(m_value) : nullptr; }
+
 private:
-	template <_ARGLESS_CORE str, _ARGLESS_CORE str, _ARGLESS_CORE parsable, _ARGLESS_CORE arg_t... args_>
-		requires _ARGLESS_CORE no_name_or_alias_collision<args_...>
-	friend struct app;
+	template <typename>
+	friend struct _ARGLESS_CORE parse_impl;
+
+	template <typename>
+	friend struct _ARGLESS_CORE compact_core;
 
 	result_error_type m_type = result_error_type::none; 
 
@@ -2847,11 +3410,16 @@ private:
 	const char_t* m_arg_type = nullptr;
 	std::size_t m_index = 0;
 	const char_t* m_expected_type = nullptr;
+
+	const char_t* m_value = nullptr;
+	const char_t* (*m_suggest)(const char_t*) = nullptr;
 };
 
-template <_ARGLESS_CORE app_t app_, typename char_t>
+template <_ARGLESS_CORE app_t app_, typename char_t, std::size_t error_capacity = 1>
 struct result
 {
+	static_assert(error_capacity > 0, "result needs room for at least one error");
+
 public:
 	using app = app_;
 
@@ -2880,163 +3448,1066 @@ public:
 	inline const auto&& get() const && { return _ARGLESS_CORE result_find<names...>::call(*this); }
 
 public:
-	inline const result_error<char_t>& error() const { return m_error; }
+	inline const result_error<char_t>& error() const { return m_errors[0]; }
+
+	// more than one only with app::parse_all<n>, in order of appearance
+	inline std::size_t error_count() const { return m_error_count; }
+	inline const result_error<char_t>& error(std::size_t index) const { return m_errors[index]; }
 
 private:
-	template <_ARGLESS_CORE str, _ARGLESS_CORE str, _ARGLESS_CORE parsable, _ARGLESS_CORE arg_t... args_>
-		requires _ARGLESS_CORE no_name_or_alias_collision<args_...>
-	friend struct _ARGLESS app;
+	template <typename>
+	friend struct _ARGLESS_CORE parse_impl;
 
 	template <_ARGLESS_CORE str...>
 	friend struct _ARGLESS_CORE result_find;
 
 	const char_t* m_path = nullptr;
-	result_error<char_t> m_error;
+	result_error<char_t> m_errors[error_capacity];
+	std::size_t m_error_count = 0;
 
 	_ARGLESS_CORE result_cast_noname<typename app::noname_arg_type> m_noname_value;
 	typename app::args::template cast<std::tuple> m_values;
 };
 
 
-template <_ARGLESS_CORE str name_, _ARGLESS_CORE str desc_, _ARGLESS_CORE parsable noname_arg_type_, _ARGLESS_CORE arg_t... args_>
-	requires _ARGLESS_CORE no_name_or_alias_collision<args_...>
-struct app
+template <_ARGLESS_CORE str name_, _ARGLESS_CORE str desc_, _ARGLESS_CORE parsable noname_arg_type_, typename... args_>
+struct page
 {
+	static_assert((_ARGLESS_CORE app_arg_t<args_> && ...), "page args must be argless::arg, argless::page, an arg group or a setting");
+	static_assert(_ARGLESS_CORE no_name_or_alias_collision<args_...>, "page arg names or aliases collide");
+
 public:
+	using app = page;
 	static constexpr auto name = name_;
 	static constexpr auto desc = desc_;
+	static constexpr auto aliases = std::make_tuple();
 	using noname_arg_type = noname_arg_type_;
-	using args = tetter<args_...>;
+	using args = typename tetter<args_...>::template filter_l<[]<typename t, std::size_t>() { return _ARGLESS_CORE arg_t<t> || _ARGLESS_CORE page_t<t>; }>;
+	using groups = typename tetter<args_...>::template filter_l<[]<typename t, std::size_t>() { return _ARGLESS_CORE group_t<t>; }>;
+	static constexpr inline bool abbreviations = (std::is_same_v<args_, _ARGLESS abbreviations> || ...);
+
+public:
+	inline constexpr operator bool() const { return m_selected; }
 
 public:
+	template <_ARGLESS_CORE str... names>
+	inline auto& get() & { return _ARGLESS_CORE result_find<names...>::call(*this); }
+
+	template <_ARGLESS_CORE str... names>
+	inline auto&& get() && { return _ARGLESS_CORE result_find<names...>::call(*this); }
+
+	template <_ARGLESS_CORE str... names>
+	inline const auto& get() const & { return _ARGLESS_CORE result_find<names...>::call(*this); }
+
+	template <_ARGLESS_CORE str... names>
+	inline const auto&& get() const && { return _ARGLESS_CORE result_find<names...>::call(*this); }
+
+private:
+	template <_ARGLESS_CORE str...>
+	friend struct _ARGLESS_CORE result_find;
+
+	template <typename>
+	friend struct _ARGLESS_CORE parse_impl;
+
+	bool m_selected = false;
+
+	_ARGLESS_CORE result_cast_noname<noname_arg_type> m_noname_value;
+	typename args::template cast<std::tuple> m_values;
+};
+
+_ARGLESS_END
+
+
+
+_ARGLESS_CORE_BEGIN
+
+template <typename t>
+struct group_impl;
+
+template <str... names_>
+struct group_impl<exclusive<names_...>>
+{
+	using names = tetter<std::integral_constant<decltype(names_), names_>...>;
+	static constexpr inline auto error = result_error_type::conflicting_args;
+	static inline constexpr bool check(std::size_t present) { return present <= 1; }
+};
+
+template <str... names_>
+struct group_impl<at_least_one<names_...>>
+{
+	using names = tetter<std::integral_constant<decltype(names_), names_>...>;
+	static constexpr inline auto error = result_error_type::missing_group_arg;
+	static inline constexpr bool check(std::size_t present) { return present >= 1; }
+};
+
+template <str... names_>
+struct group_impl<all_or_none<names_...>>
+{
+	using names = tetter<std::integral_constant<decltype(names_), names_>...>;
+	static constexpr inline auto error = result_error_type::incomplete_group;
+	static inline constexpr bool check(std::size_t present) { return !present || present == names::count; }
+};
+
+// "name, name, ..." reported as error arg name
+template <typename t, typename char_t>
+constexpr inline auto group_name = group_impl<t>::names::pop_front::invoke_pipe([]<typename n>(auto str){ return [](){ return decltype(str){}() + str_from<char_t, ", ">() + str_cast<char_t, n::value>(); }; },
+	[](){ return str_cast<char_t, group_impl<t>::names::front::value>(); })();
+
+// errors of one parse, with capacity > 1 parsing goes on after recoverable errors
+template <typename char_t, std::size_t capacity>
+struct error_sink
+{
+	result_error<char_t>* m_errors;
+	std::size_t m_count = 0;
+
+	// clean slot for the next error
+	inline result_error<char_t>& next() { return m_errors[m_count] = result_error<char_t>(); }
+
+	// false when parsing has to stop
+	inline bool commit()
+	{
+		++m_count;
+		if constexpr (capacity == 1)
+			return false;
+		else
+			return m_count < capacity;
+	}
+};
+
+template <typename char_t>
+struct name_entry
+{
+	const char_t* m_name = nullptr;
+	std::size_t m_size = 0;
+	std::size_t m_arg = 0; // index + 1
+	bool m_page = false;
+	bool m_value = false; // arg is not a flag
+	bool m_negated = false; // "--no-" form of a negatable arg
+};
+
+// fills the token table from argv (reusing its storage), "--" is only located here
+template <typename char_t>
+inline void tokenize(args<char_t>& args, int argc, const char_t** argv, const char_t** rest)
+{
+	args.m_args.clear();
+	args.m_args.reserve(argc);
+	args.m_marker = 0;
+	for (decltype(argc) i = 0; i < argc; ++i)
+	{
+		args.m_args.emplace_back(argv[i]);
+		if (!args.m_marker && i && argv[i][0] == '-' && argv[i][1] == '-' && !argv[i][2])
+			args.m_marker = i + 1;
+	}
+	args.m_index = 0;
+	args.m_limit = args.m_marker ? args.m_marker - 1 : args.m_args.size();
+	args.m_force = false;
+	args.m_rest = rest;
+	args.m_rest_count = 0;
+	args.m_terminal = 0;
+}
+
+// at "--" skips it and opens the tokens after it, which are never classified and go to noname arg (or rest),
+// a container noname arg given before it continues with them
+template <typename char_t>
+inline bool end_of_options(args<char_t>& args)
+{
+	if (!args.m_marker || args.m_index != args.m_marker - 1)
+		return false;
+	args.m_index = args.m_marker;
+	args.m_limit = args.m_args.size();
+	args.m_marker = 0;
+	return args.m_index < args.m_limit;
+}
+
+// splits unmatched "-abc", "-j8" and "--name=value" tokens in place, parts point into the token
+// or at static names (nothing is copied), returns count of inserted entries,
+// shorts holds the "-c" names by ascii c
+template <typename char_t>
+inline std::size_t split_token(args<char_t>& args, std::size_t i, const name_entry<char_t>* names, std::size_t name_count, const name_entry<char_t>* shorts)
+{
+	using arg_t = typename _ARGLESS_CORE args<char_t>::arg;
+	const char_t* value = args.m_args[i].m_value;
+	if (value[0] != '-' || !value[1])
+		return 0;
+
+	for (const char_t* it = value + 1; *it; ++it)
+		if (*it == '=')
+		{
+			for (std::size_t n = 0; n < name_count; ++n)
+			{
+				auto& entry = names[n];
+				if (entry.m_value && entry.m_size == static_cast<std::size_t>(it - value) && seq_n(entry.m_name, value, entry.m_size))
+				{
+					args.m_args[i].m_arg = entry.m_arg;
+					args.m_args.insert(args.m_args.begin() + i + 1, arg_t{ it + 1 });
+					++args.m_limit;
+					if (args.m_marker) ++args.m_marker;
+					return 1;
+				}
+			}
+			return 0;
+		}
+
+	if (value[1] == '-')
+		return 0;
+
+	// whole cluster has to be known, otherwise token stays as it is (e.g. negative numbers)
+	std::size_t count = 0;
+	const char_t* attached = nullptr;
+	for (const char_t* it = value + 1; *it; ++it)
+	{
+		if (static_cast<char32_t>(*it) >= 128 || !shorts[static_cast<char32_t>(*it)].m_arg)
+			return 0;
+		++count;
+		if (shorts[static_cast<char32_t>(*it)].m_value)
+		{
+			if (it[1]) attached = it + 1;
+			break;
+		}
+	}
+
+	std::size_t added = count - 1 + (attached ? 1 : 0);
+	if (added)
+		args.m_args.insert(args.m_args.begin() + i + 1, added, arg_t{ nullptr });
+	for (std::size_t c = 0; c < count; ++c)
+	{
+		auto& entry = shorts[static_cast<char32_t>(value[1 + c])];
+		args.m_args[i + c] = arg_t{ entry.m_name, entry.m_arg };
+	}
+	if (attached)
+		args.m_args[i + count] = arg_t{ attached };
+	args.m_limit += added;
+	if (args.m_marker) args.m_marker += added;
+	return added;
+}
+
+// bounded edit distance search over names, only lengths within the bound are scored
+template <typename char_t>
+inline const char_t* suggest_name(const char_t* value, const name_entry<char_t>* names, std::size_t name_count)
+{
+	edit_pattern<char_t> pattern(value);
+	if (!pattern.valid()) return nullptr;
+
+	std::size_t best = pattern.m_size < 4 ? 1 : pattern.m_size < 8 ? 2 : 3;
+	const char_t* result = nullptr;
+
+	for (std::size_t n = 0; n < name_count; ++n)
+	{
+		auto& entry = names[n];
+		std::size_t diff = entry.m_size > pattern.m_size ? entry.m_size - pattern.m_size : pattern.m_size - entry.m_size;
+		if (diff > best || (result && diff == best)) continue;
+
+		// a name which has to be rewritten completely is no suggestion
+		std::size_t distance = pattern.distance(entry.m_name, entry.m_size);
+		if (distance && distance < entry.m_size && distance < pattern.m_size && (distance < best || (!result && distance == best)))
+		{
+			best = distance;
+			result = entry.m_name;
+		}
+	}
+
+	return result;
+}
+
+// parse loop shared by app and page
+template <typename app_like>
+struct parse_impl
+{
+	using values = typename app_like::args;
+	using noname_arg_type = typename app_like::noname_arg_type;
+
+	using groups = typename app_like::groups;
+
+	static constexpr inline bool has_pages = values::template value_l<[]<typename t, std::size_t>() { return page_t<t>; }>::any;
+
+	// one bit per arg/page, set when its name is dispatched, so group checks dont depend on arg count
+	static constexpr inline std::size_t presence_words = groups::count ? (values::count + 63) / 64 : 0;
+	using presence_t = std::array<std::uint64_t, presence_words>;
+
+	template <typename group>
+	static constexpr inline presence_t group_mask = [](){
+		presence_t mask{};
+		group_impl<group>::names::invoke([&]<typename n, std::size_t>() {
+			constexpr auto index = values::template find_l<[]<typename t, std::size_t>() {
+				return seq(t::name.data(), n::value.data()) ||
+					tetter_sequence<tetter_from<decltype(t::aliases)>::count>::template value_l<[]<std::size_t i>() {
+						return seq(std::get<i>(t::aliases).data(), n::value.data());
+					}>::any;
+			}>::index;
+			static_assert(index != values::count, "group names an arg which is not in this app/page");
+			mask[index / 64] |= std::uint64_t(1) << (index % 64);
+		});
+		return mask;
+	}();
+
+	template <typename t>
+	static constexpr inline bool negatable_arg = [](){
+		if constexpr (page_t<t>) return false;
+		else return is_negatable<typename t::type>::value;
+	}();
+
+	static constexpr inline bool has_negatable = values::template value_l<[]<typename t, std::size_t>() { return negatable_arg<t>; }>::any;
+
+	// every arg name, alias, generated "--no-" name and page name of this app/page
 	template <typename char_t>
-	static result<app, char_t> parse(int argc, const char_t** argv)
+	static constexpr inline auto name_table = [](){
+		constexpr std::size_t count = [](){
+			std::size_t count = 0;
+			values::invoke([&]<typename t, std::size_t>() {
+				count += 1 + tetter_from<decltype(t::aliases)>::count;
+				if constexpr (negatable_arg<t>)
+				{
+					count += is_long_name<t::name>;
+					tetter_sequence<tetter_from<decltype(t::aliases)>::count>::invoke([&]<std::size_t a>() { count += is_long_name<std::get<a>(t::aliases)>; });
+				}
+			});
+			return count;
+		}();
+
+		std::array<name_entry<char_t>, count> table{};
+		std::size_t i = 0;
+		values::invoke([&]<typename t, std::size_t t_i>() {
+			constexpr bool value = [](){
+				if constexpr (page_t<t>) return false;
+				else return !std::is_void_v<parse_cast<typename t::type>>;
+			}();
+			table[i++] = { static_str<str_cast<char_t, t::name>()>.data(), str_cast<char_t, t::name>().size() - 1, t_i + 1, page_t<t>, value };
+			tetter_sequence<tetter_from<decltype(t::aliases)>::count>::invoke([&]<std::size_t a>() {
+				table[i++] = { static_str<str_cast<char_t, std::get<a>(t::aliases)>()>.data(), str_cast<char_t, std::get<a>(t::aliases)>().size() - 1, t_i + 1, false, value };
+			});
+
+			if constexpr (negatable_arg<t>)
+			{
+				if constexpr (is_long_name<t::name>)
+					table[i++] = { static_str<str_cast<char_t, negated_name<t::name>()>()>.data(), str_cast<char_t, negated_name<t::name>()>().size() - 1, t_i + 1, false, false, true };
+				tetter_sequence<tetter_from<decltype(t::aliases)>::count>::invoke([&]<std::size_t a>() {
+					if constexpr (is_long_name<std::get<a>(t::aliases)>)
+						table[i++] = { static_str<str_cast<char_t, negated_name<std::get<a>(t::aliases)>()>()>.data(), str_cast<char_t, negated_name<std::get<a>(t::aliases)>()>().size() - 1, t_i + 1, false, false, true };
+				});
+			}
+		});
+		return table;
+	}();
+
+	template <typename t>
+	static constexpr inline repeat_policy repeat_of = [](){
+		if constexpr (page_t<t>) return repeat_policy::error;
+		else return t::repeat;
+	}();
+
+	static constexpr inline bool has_terminal = values::template value_l<[]<typename t, std::size_t>() {
+		if constexpr (page_t<t>) return false;
+		else return t::terminal;
+	}>::any;
+
+	static inline bool is_terminal(std::size_t arg)
 	{
-		_ARGLESS_CORE args<char_t> args = [&](){
-			std::vector<typename _ARGLESS_CORE args<char_t>::arg> _args;
-			_args.reserve(argc);
-			for (decltype(argc) i = 0; i < argc; ++i)
-				_args.emplace_back(argv[i],
-					args::invoke_pipe([&]<typename t, std::size_t t_i>(std::size_t index) {
-						if (index) return index;
-						return (_ARGLESS_CORE seq(t::name.data(), argv[i]) ||
-							tetter_sequence<tetter_from<decltype(t::aliases)>::count>::invoke_any([&]<typename, std::size_t index>() {
-								return _ARGLESS_CORE seq(std::get<index>(t::aliases).data(), argv[i]);
-							})
-						) ? t_i + 1 : 0;
-					}, 0)
-				);
-			return _args;
+		constexpr auto terminals = [](){
+			std::array<bool, values::count> terminals{};
+			values::invoke([&]<typename t, std::size_t i>() {
+				if constexpr (!page_t<t>) terminals[i] = t::terminal;
+			});
+			return terminals;
 		}();
-		result<app, char_t> result;
-		result.m_error.m_type = result_error_type::unknown;
+		return arg && arg <= values::count && terminals[arg - 1];
+	}
 
-		if (auto path = args.peak())
-			result.m_path = (args.consume(), *path);
+	template <typename t>
+	static constexpr inline bool picked_arg = repeat_of<t> == repeat_policy::first_wins || repeat_of<t> == repeat_policy::last_wins;
+
+	static constexpr inline bool has_picked = values::template value_l<[]<typename t, std::size_t>() { return picked_arg<t>; }>::any;
 
-		while (args.m_index < args.m_limit)
+	// token index + 1 of the occurrence which is parsed, per first/last wins arg
+	using picked_t = std::array<std::size_t, has_picked ? values::count : 0>;
+
+	template <typename char_t>
+	static inline picked_t pick(const args<char_t>& args)
+	{
+		picked_t picked{};
+		if constexpr (has_picked)
+		{
+			constexpr auto policies = [](){
+				std::array<repeat_policy, values::count> policies{};
+				values::invoke([&]<typename t, std::size_t i>() { policies[i] = repeat_of<t>; });
+				return policies;
+			}();
+
+			for (std::size_t k = args.m_index; k < args.m_limit; ++k)
+			{
+				std::size_t arg = args.m_args[k].m_arg;
+				if (!arg || arg > values::count) continue;
+				if (policies[arg - 1] == repeat_policy::last_wins || (policies[arg - 1] == repeat_policy::first_wins && !picked[arg - 1]))
+					picked[arg - 1] = k + 1;
+			}
+		}
+		return picked;
+	}
+
+	// first "--no-" name of each negatable arg, negated tokens point at it so run tells them apart by address,
+	// taken names are tracked apart since comparing the address of a static with null is no constant expression with -fsanitize
+	template <typename char_t>
+	static constexpr inline auto negated_names = [](){
+		std::array<const char_t*, values::count> names{};
+		std::array<bool, values::count> taken{};
+		for (auto& entry : name_table<char_t>)
+			if (entry.m_negated && !taken[entry.m_arg - 1])
+			{
+				names[entry.m_arg - 1] = entry.m_name;
+				taken[entry.m_arg - 1] = true;
+			}
+		return names;
+	}();
+
+	template <typename char_t>
+	static inline void select(typename _ARGLESS_CORE args<char_t>::arg& arg, const name_entry<char_t>& entry)
+	{
+		arg.m_arg = entry.m_arg;
+		if constexpr (has_negatable)
+			if (entry.m_negated)
+				arg.m_value = negated_names<char_t>[entry.m_arg - 1];
+	}
+
+	template <typename char_t>
+	static inline void find_negated(args<char_t>& args, std::size_t i)
+	{
+		auto& arg = args.m_args[i];
+		for (auto& entry : name_table<char_t>)
+			if (entry.m_negated && seq(entry.m_name, arg.m_value))
+				return select(arg, entry);
+	}
+
+	// args named "-c" (name or alias) by ascii c, for clusters (-abc) and attached values (-j8)
+	template <typename char_t>
+	static constexpr inline auto short_table = [](){
+		std::array<name_entry<char_t>, 128> table{};
+		for (auto& entry : name_table<char_t>)
+			if (!entry.m_page && entry.m_size == 2 && entry.m_name[0] == '-' && entry.m_name[1] != '-' && static_cast<char32_t>(entry.m_name[1]) < 128)
+				table[static_cast<char32_t>(entry.m_name[1])] = entry;
+		return table;
+	}();
+
+	// "--" names and aliases sorted by code units, names sharing a prefix are adjacent
+	template <typename char_t>
+	static constexpr inline auto prefix_table = [](){
+		constexpr auto is_long = [](const name_entry<char_t>& entry) { return !entry.m_page && entry.m_size > 2 && entry.m_name[0] == '-' && entry.m_name[1] == '-'; };
+		constexpr std::size_t count = [&](){
+			std::size_t count = 0;
+			for (auto& entry : name_table<char_t>)
+				count += is_long(entry);
+			return count;
+		}();
+
+		std::array<name_entry<char_t>, count> table{};
+		std::size_t size = 0;
+		for (auto& entry : name_table<char_t>)
+			if (is_long(entry))
+				table[size++] = entry;
+		heap_sort(table.data(), size, [](const name_entry<char_t>& l, const name_entry<char_t>& r) { return scmp(l.m_name, r.m_name) < 0; });
+		return table;
+	}();
+
+	// marks a token which is a prefix of several args
+	static constexpr inline std::size_t ambiguous = static_cast<std::size_t>(-1);
+
+	// size of the name part of "--name=value" (whole token without '=')
+	template <typename char_t>
+	static inline std::size_t name_size(const char_t* value)
+	{
+		std::size_t size = 0;
+		while (value[size] && value[size] != '=')
+			++size;
+		return size;
+	}
+
+	// range of prefix_table entries starting with the first size chars of value, two binary searches
+	template <typename char_t>
+	static inline std::pair<std::size_t, std::size_t> prefix_range(const char_t* value, std::size_t size)
+	{
+		auto& table = prefix_table<char_t>;
+		std::size_t first = 0, last = table.size();
+		while (first < last)
+		{
+			std::size_t mid = first + (last - first) / 2;
+			if (scmp_n(table[mid].m_name, value, size) < 0) first = mid + 1;
+			else last = mid;
+		}
+
+		std::size_t end = first;
+		last = table.size();
+		while (end < last)
+		{
+			std::size_t mid = end + (last - end) / 2;
+			if (!scmp_n(table[mid].m_name, value, size)) end = mid + 1;
+			else last = mid;
+		}
+		return { first, end };
+	}
+
+	// selects the arg of an unambiguous "--" prefix (aliases of one arg are not ambiguous) or marks it ambiguous,
+	// "--abbr=value" is resolved on the part before '=' and split like "--name=value", returns count of inserted entries
+	template <typename char_t>
+	static inline std::size_t find_abbreviation(args<char_t>& args, std::size_t i)
+	{
+		using arg_t = typename _ARGLESS_CORE args<char_t>::arg;
+		auto& arg = args.m_args[i];
+		const char_t* value = arg.m_value;
+		if (value[0] != '-' || value[1] != '-')
+			return 0;
+
+		std::size_t size = name_size(value);
+		if (size <= 2)
+			return 0;
+
+		auto [first, end] = prefix_range(value, size);
+		if (first == end)
+			return 0;
+
+		// a whole name is never ambiguous ("--level=3" next to "--level-max")
+		auto& table = prefix_table<char_t>;
+		if (table[first].m_size != size)
+			for (std::size_t j = first + 1; j < end; ++j)
+				if (table[j].m_arg != table[first].m_arg || table[j].m_negated != table[first].m_negated)
+				{
+					arg.m_arg = ambiguous;
+					return 0;
+				}
+
+		if (!value[size])
+		{
+			select(arg, table[first]);
+			return 0;
+		}
+
+		// flags take no "=value", the token stays unmatched
+		if (!table[first].m_value)
+			return 0;
+
+		select(arg, table[first]);
+		args.m_args.insert(args.m_args.begin() + i + 1, arg_t{ value + size + 1 });
+		++args.m_limit;
+		if (args.m_marker) ++args.m_marker;
+		return 1;
+	}
+
+	// first candidate of an ambiguous prefix
+	template <typename char_t>
+	static inline const char_t* suggest_abbreviation(const char_t* value)
+	{
+		auto [first, end] = prefix_range(value, name_size(value));
+		return first != end ? prefix_table<char_t>[first].m_name : nullptr;
+	}
+
+	template <typename char_t>
+	static inline std::size_t split(args<char_t>& args, std::size_t i)
+	{
+		return split_token(args, i, name_table<char_t>.data(), name_table<char_t>.size(), short_table<char_t>.data());
+	}
+
+	template <typename char_t>
+	static inline const char_t* suggest(const char_t* value)
+	{
+		return suggest_name(value, name_table<char_t>.data(), name_table<char_t>.size());
+	}
+
+	// false when parsing has to stop
+	template <typename char_t, std::size_t capacity>
+	static inline bool check_groups(const presence_t& presence, error_sink<char_t, capacity>& sink)
+	{
+		return groups::invoke_none([&]<typename t, std::size_t>() -> bool {
+			std::size_t present = 0;
+			for (std::size_t i = 0; i < presence_words; ++i)
+				present += std::popcount(presence[i] & group_mask<t>[i]);
+
+			if (group_impl<t>::check(present)) return false;
+			auto& error = sink.next();
+			error.m_type = group_impl<t>::error;
+			error.m_arg_name = static_str<group_name<t, char_t>>;
+			return !sink.commit();
+		});
+	}
+
+	// resets values in place (containers keep their capacity)
+	template <typename holder_t>
+	static inline void reset(holder_t& holder)
+	{
+		if constexpr (!std::is_void_v<noname_arg_type>)
+			result_reset<noname_arg_type>::call(holder.m_noname_value);
+
+		values::invoke([&]<typename t, std::size_t i>() {
+			auto& value = std::get<i>(holder.m_values);
+			if constexpr (page_t<t>)
+			{
+				value.m_selected = false;
+				parse_impl<t>::reset(value);
+			}
+			else
+				result_reset<typename t::type>::call(value.m_value);
+		});
+	}
+
+	template <typename char_t>
+	static inline std::size_t find_arg(const char_t* value)
+	{
+		return values::invoke_pipe([&]<typename t, std::size_t t_i>(std::size_t index) -> std::size_t {
+			if constexpr (page_t<t>)
+				return index;
+			else
+			{
+				if (index) return index;
+				return (seq(t::name.data(), value) ||
+					tetter_sequence<tetter_from<decltype(t::aliases)>::count>::invoke_any([&]<typename, std::size_t index>() {
+						return seq(std::get<index>(t::aliases).data(), value);
+					})
+				) ? t_i + 1 : 0;
+			}
+		}, std::size_t(0));
+	}
+
+	// page names are only matched against tokens which are not args
+	template <typename char_t>
+	static inline std::size_t find_page(const char_t* value)
+	{
+		return values::invoke_pipe([&]<typename t, std::size_t t_i>(std::size_t index) -> std::size_t {
+			if constexpr (!page_t<t>)
+				return index;
+			else
+			{
+				if (index) return index;
+				// first char is known at compile-time, so mismatching pages are rejected without seq
+				if (static_cast<char32_t>(*value) != static_cast<char32_t>(t::name.m_buffer[0])) return 0;
+				return seq(t::name.data(), value) ? t_i + 1 : 0;
+			}
+		}, std::size_t(0));
+	}
+
+	// tokens after a page name are left for that page to classify,
+	// after a terminal arg only tokens up to the next arg are classified and m_limit ends after it (forced values can take it)
+	template <typename char_t>
+	static inline void classify(args<char_t>& args, std::size_t from, bool values_only = false)
+	{
+		for (std::size_t i = from; i < args.m_limit; ++i)
+		{
+			auto& arg = args.m_args[i];
+			arg.m_arg = find_arg(arg.m_value);
+
+			if constexpr (has_negatable)
+				if (!arg.m_arg)
+					find_negated(args, i);
+
+			if constexpr (has_pages)
+				if (!arg.m_arg && (arg.m_arg = find_page(arg.m_value)))
+				{
+					if (values_only)
+					{
+						args.m_limit = i + 1;
+						return;
+					}
+					for (++i; i < args.m_limit; ++i)
+						args.m_args[i].m_arg = 0;
+					return;
+				}
+
+			std::size_t added = 0;
+			if constexpr (app_like::abbreviations)
+				if (!arg.m_arg)
+					added = find_abbreviation(args, i);
+
+			if (!args.m_args[i].m_arg)
+				added = split(args, i);
+
+			if constexpr (has_terminal)
+			{
+				if (values_only)
+				{
+					if (args.m_args[i].m_arg)
+					{
+						args.m_limit = i + 1;
+						return;
+					}
+				}
+				else
+					for (std::size_t k = i; k <= i + added; ++k)
+						if (is_terminal(args.m_args[k].m_arg))
+						{
+							args.m_terminal = k + 1;
+							for (std::size_t v = k + 1; v <= i + added; ++v)
+								if (args.m_args[v].m_arg)
+								{
+									args.m_limit = v + 1;
+									return;
+								}
+							classify(args, i + added + 1, true);
+							return;
+						}
+			}
+
+			i += added;
+		}
+	}
+
+	// false when parsing has to stop, after a recoverable error tokens are skipped to the next arg
+	template <typename char_t, std::size_t capacity, typename holder_t>
+	static inline bool run(holder_t& holder, error_sink<char_t, capacity>& sink, args<char_t>& args)
+	{
+		[[maybe_unused]] presence_t presence{};
+		[[maybe_unused]] picked_t picked = pick(args);
+
+		// tokens before a terminal arg are not parsed
+		if constexpr (has_terminal)
+			if (args.m_terminal > args.m_index)
+				args.m_index = args.m_terminal - 1;
+
+		bool opened = false;
+		while (args.m_index < args.m_limit || (opened = end_of_options(args)))
 		{
 			auto& arg_index = args.m_index;
 			auto& arg = args.m_args[arg_index];
+			[[maybe_unused]] std::size_t at = arg_index;
 
 			auto parse = [&]<typename t, std::size_t i>() -> bool
 			{
-				using type = _ARGLESS_CORE parse_cast<t>;
+				using type = parse_cast<t>;
 				auto insert = [&](auto&&... as) -> bool {
-					if (!_ARGLESS_CORE result_insert<t>::call(std::forward<decltype(as)>(as)...))
+					constexpr bool merge = [](){
+						if constexpr (i) return values::template get<i-1>::repeat == repeat_policy::merge;
+						else return false;
+					}();
+					bool inserted;
+					if constexpr (merge)
+						inserted = result_merge<t>::call(std::forward<decltype(as)>(as)...);
+					else if constexpr (!i && continued_noname<t>)
+						inserted = opened ? result_merge<t>::call(std::forward<decltype(as)>(as)...) : result_insert<t>::call(std::forward<decltype(as)>(as)...);
+					else
+						inserted = result_insert<t>::call(std::forward<decltype(as)>(as)...);
+					if (!inserted)
 					{
-						result.m_error.m_type = result_error_type::ambiguous_arg_value;
-						result.m_error.m_arg_index = arg_index;
-						if constexpr (i) result.m_error.m_arg_name = _ARGLESS_CORE static_str<_ARGLESS_CORE str_cast<char_t, args::template get<i-1>::name>()>;
-						result.m_error.m_arg_type = get_name<type, char_t>();
+						auto& error = sink.next();
+						error.m_type = result_error_type::ambiguous_arg_value;
+						error.m_arg_index = arg_index;
+						if constexpr (i) error.m_arg_name = static_str<str_cast<char_t, values::template get<i-1>::name>()>;
+						error.m_arg_type = get_name<type, char_t>();
 						return true;
 					}
 					return false;
 				};
 
+				if constexpr (i && is_negatable<t>::value)
+					if (arg.m_value == negated_names<char_t>[i - 1])
+						return insert(std::get<i - 1>(holder.m_values).m_value, false);
+
 				if constexpr (std::is_void_v<type>)
 				{
 					if constexpr (i)
-						return insert(std::get<i - 1>(result.m_values).m_value);
+						return insert(std::get<i - 1>(holder.m_values).m_value);
 					else
-						return insert(result.m_noname_value);
+						return insert(holder.m_noname_value);
 				}
 				else
 				{
-					auto presult = _ARGLESS_CORE parser<type>::template parse<char_t>(args);
+					auto presult = parser<type>::template parse<char_t>(args);
 
 					if (!presult.is_valid())
 					{
-						result.m_error.m_type = result_error_type::invalid_arg_value;
-						result.m_error.m_arg_index = arg_index;
-						if constexpr (i) result.m_error.m_arg_name = _ARGLESS_CORE static_str<_ARGLESS_CORE str_cast<char_t, args::template get<i-1>::name>()>;
-						result.m_error.m_arg_type = get_name<type, char_t>();
-						result.m_error.m_index = args.m_index;
-						result.m_error.m_expected_type = presult.expected().what();
+						auto& error = sink.next();
+						error.m_type = result_error_type::invalid_arg_value;
+						error.m_arg_index = arg_index;
+						if constexpr (i) error.m_arg_name = static_str<str_cast<char_t, values::template get<i-1>::name>()>;
+						error.m_arg_type = get_name<type, char_t>();
+						error.m_index = args.m_index;
+						error.m_expected_type = presult.expected().what();
+						// at m_limit (e.g. "--name -- x") the value is missing, "--" is not reported as one
+						if (args.m_index < args.m_limit && !args.m_args[args.m_index].m_arg)
+						{
+							error.m_value = args.m_args[args.m_index].m_value;
+							error.m_suggest = &suggest<char_t>;
+						}
 						return true;
 					}
 
 					if constexpr (i)
-						return insert(std::get<i - 1>(result.m_values).m_value, std::move(presult).get());
+						return insert(std::get<i - 1>(holder.m_values).m_value, std::move(presult).get());
 					else
-						return insert(result.m_noname_value, std::move(presult).get());
+						return insert(holder.m_noname_value, std::move(presult).get());
 				}
 
 				return false;
 			};
 
-			if (arg.m_arg)
+			bool failed = false;
+
+			if (app_like::abbreviations && arg.m_arg == ambiguous)
 			{
+				auto& error = sink.next();
+				error.m_type = result_error_type::ambiguous_arg;
+				error.m_index = arg_index;
+				error.m_value = arg.m_value;
+				error.m_suggest = &suggest_abbreviation<char_t>;
 				args.consume();
-				if (args::invoke_none([&]<typename t, std::size_t i>() -> bool {
+				failed = true;
+			}
+			else if (arg.m_arg)
+			{
+				if constexpr (groups::count)
+					presence[(arg.m_arg - 1) / 64] |= std::uint64_t(1) << ((arg.m_arg - 1) % 64);
+
+				args.consume();
+				bool stop = false;
+				values::invoke_any([&]<typename t, std::size_t i>() -> bool {
 					if (i != arg.m_arg - 1) return false;
-					if (parse.template operator()<typename t::type, i + 1>()) return false;
+					if constexpr (page_t<t>)
+					{
+						auto& page = std::get<i>(holder.m_values);
+						page.m_selected = true;
+						parse_impl<t>::classify(args, args.m_index);
+						stop = !parse_impl<t>::run(page, sink, args);
+					}
+					else if constexpr (picked_arg<t>)
+					{
+						if (picked[i] == at + 1)
+							failed = parse.template operator()<typename t::type, i + 1>();
+						else if constexpr (!std::is_void_v<parse_cast<typename t::type>>)
+						{
+							bool negated = false;
+							if constexpr (is_negatable<typename t::type>::value)
+								negated = arg.m_value == negated_names<char_t>[i];
+							if (!negated)
+								parse_skip<parse_cast<typename t::type>>(args);
+						}
+					}
+					else
+						failed = parse.template operator()<typename t::type, i + 1>();
 					return true;
-				})) return result;
+				});
+				if (stop) return false;
+			}
+			else if (args.m_rest)
+			{
+				args.m_rest[args.m_rest_count++] = arg.m_value;
+				args.consume();
 			}
 			else if constexpr (!std::is_void_v<noname_arg_type>)
 			{
-				if (parse.template operator()<noname_arg_type, 0>()) return result;
+				failed = parse.template operator()<noname_arg_type, 0>();
 			}
 			else
 			{
-				result.m_error.m_type = result_error_type::stray_value;
-				result.m_error.m_index = arg_index;
-				return result;
+				auto& error = sink.next();
+				error.m_type = result_error_type::stray_value;
+				error.m_index = arg_index;
+				error.m_value = arg.m_value;
+				error.m_suggest = &suggest<char_t>;
+				failed = true;
 			}
+
+			if (failed)
+			{
+				if (!sink.commit()) return false;
+				while (args.m_index < args.m_limit && !args.m_args[args.m_index].m_arg)
+					args.consume();
+			}
+
+			// terminal arg of this app/page or of a selected page, required args and groups are not checked
+			if constexpr (has_terminal || has_pages)
+				if (args.m_terminal)
+					return true;
 		}
 
-		if (args::invoke_any([&]<typename t, std::size_t i>() -> bool {
-			if constexpr (_ARGLESS_CORE is_required<typename t::type>::value)
-			{
-				using type = typename t::type;
-				auto& value = std::get<i>(result.m_values).m_value;
-				if (!static_cast<bool>(value))
-				{
-					result.m_error.m_type = result_error_type::missing_arg;
-					result.m_error.m_arg_name = _ARGLESS_CORE static_str<_ARGLESS_CORE str_cast<char_t, t::name>()>;
-					result.m_error.m_arg_type = get_name<_ARGLESS_CORE parse_cast<type>, char_t>();
-					return true;
-				}
-			}
-			else if constexpr(_ARGLESS_CORE is_default_value<typename t::type>::value)
-			{
-				using type = typename t::type;
-				auto& value = std::get<i>(result.m_values).m_value;
-				if (!value)
-				{
-					if constexpr (std::is_convertible_v<decltype(type::value), typename _ARGLESS_CORE parser<_ARGLESS_CORE parse_cast<type>>::type>) 
-						value = type::value;
-					else
-						value = type::value();
-				}
-			}
-			return false;
-		})) return result;
+		if (!values::invoke_none([&]<typename t, std::size_t i>() -> bool {
+			if constexpr (page_t<t>)
+				return false;
+			else if constexpr (is_required<typename t::type>::value)
+			{
+				using type = typename t::type;
+				auto& value = std::get<i>(holder.m_values).m_value;
+				if (!static_cast<bool>(value))
+				{
+					auto& error = sink.next();
+					error.m_type = result_error_type::missing_arg;
+					error.m_arg_name = static_str<str_cast<char_t, t::name>()>;
+					error.m_arg_type = get_name<parse_cast<type>, char_t>();
+					return !sink.commit();
+				}
+			}
+			else if constexpr(is_default_value<typename t::type>::value)
+			{
+				using type = typename t::type;
+				auto& value = std::get<i>(holder.m_values).m_value;
+				if (!value)
+				{
+					if constexpr (std::is_convertible_v<decltype(type::value), typename parser<parse_cast<type>>::type>) 
+						value = type::value;
+					else
+						value = type::value();
+				}
+			}
+			return false;
+		})) return false;
+
+		if constexpr (groups::count)
+			return check_groups(presence, sink);
+		else
+			return true;
+	}
+
+	// reuses storage of both args and result, returns count of tokens forwarded to rest
+	template <typename char_t, std::size_t capacity>
+	static inline std::size_t parse_into(result<app_like, char_t, capacity>& result, args<char_t>& args, int argc, const char_t** argv, const char_t** rest = nullptr)
+	{
+#if defined(ARGLESS_COMPACT_CORE)
+		if constexpr (!has_pages && !app_like::abbreviations)
+			return compact_parse_into(result, args, argc, argv, rest);
+#endif
+
+		tokenize(args, argc, argv, rest);
+		// argv[0] is the path, never an arg or page
+		classify(args, 1);
+
+		result.m_path = nullptr;
+		reset(result);
+
+		if (auto path = args.peak())
+			result.m_path = (args.consume(), *path);
+
+		error_sink<char_t, capacity> sink{ result.m_errors };
+		run(result, sink, args);
+		if (!(result.m_error_count = sink.m_count))
+			result.m_errors[0] = result_error<char_t>();
+
+		if (rest)
+			rest[args.m_rest_count] = nullptr;
+		return args.m_rest_count;
+	}
+
+	// ARGLESS_COMPACT_CORE: only the value pointers are per app, parsing runs on compact_core and its descriptor tables
+	template <typename char_t, std::size_t capacity>
+	static inline std::size_t compact_parse_into(result<app_like, char_t, capacity>& result, args<char_t>& args, int argc, const char_t** argv, const char_t** rest)
+	{
+		std::array<void*, values::count> value_ptrs;
+		values::invoke([&]<typename, std::size_t i>() { value_ptrs[i] = &std::get<i>(result.m_values).m_value; });
+
+		presence_t presence{};
+		std::array<std::size_t, has_picked ? values::count : 0> picked{};
+
+		compact_state<char_t> state{ value_ptrs.data(), &result.m_noname_value, presence.data(), picked.data(), &result.m_path, result.m_errors, capacity, &result.m_error_count };
+		return compact_core<char_t>::parse_into(compact_tables<app_like, char_t>::table, state, args, argc, argv, rest);
+	}
+};
+
+// entry of every app parse, not inline so translation units sharing an app can declare it extern template
+// and one of them instantiates it (ARGLESS_EXTERN_APP / ARGLESS_INSTANTIATE_APP)
+template <typename app, typename char_t, std::size_t capacity>
+std::size_t parse_entry(result<app, char_t, capacity>& result, args<char_t>& args, int argc, const char_t** argv, std::type_identity_t<const char_t**> rest)
+{
+	return parse_impl<app>::parse_into(result, args, argc, argv, rest);
+}
+
+_ARGLESS_CORE_END
+
+// in a header next to the app: ARGLESS_EXTERN_APP(my_app, char);
+// in one source file: ARGLESS_INSTANTIATE_APP(my_app, char);
+// _N variants are for results of parse_all<n> and parser_context::parse_into with n errors
+#define ARGLESS_EXTERN_APP_N(app, char_t, n) extern template std::size_t _ARGLESS_CORE parse_entry<app, char_t, n>(_ARGLESS result<app, char_t, n>&, _ARGLESS_CORE args<char_t>&, int, const char_t**, const char_t**)
+#define ARGLESS_INSTANTIATE_APP_N(app, char_t, n) template std::size_t _ARGLESS_CORE parse_entry<app, char_t, n>(_ARGLESS result<app, char_t, n>&, _ARGLESS_CORE args<char_t>&, int, const char_t**, const char_t**)
+#define ARGLESS_EXTERN_APP(app, char_t) ARGLESS_EXTERN_APP_N(app, char_t, 1)
+#define ARGLESS_INSTANTIATE_APP(app, char_t) ARGLESS_INSTANTIATE_APP_N(app, char_t, 1)
+
+_ARGLESS_BEGIN
+
+template <_ARGLESS_CORE str name_, _ARGLESS_CORE str desc_, _ARGLESS_CORE parsable noname_arg_type_, _ARGLESS_CORE app_arg_t... args_>
+	requires _ARGLESS_CORE no_name_or_alias_collision<args_...>
+struct app
+{
+public:
+	static constexpr auto name = name_;
+	static constexpr auto desc = desc_;
+	using noname_arg_type = noname_arg_type_;
+	using args = typename tetter<args_...>::template filter_l<[]<typename t, std::size_t>() { return _ARGLESS_CORE arg_t<t> || _ARGLESS_CORE page_t<t>; }>;
+	using groups = typename tetter<args_...>::template filter_l<[]<typename t, std::size_t>() { return _ARGLESS_CORE group_t<t>; }>;
+	static constexpr inline bool abbreviations = (std::is_same_v<args_, _ARGLESS abbreviations> || ...);
+
+public:
+	template <typename char_t>
+	static result<app, char_t> parse(int argc, const char_t** argv)
+	{
+		result<app, char_t> result;
+		_ARGLESS_CORE args<char_t> args;
+		_ARGLESS_CORE parse_entry(result, args, argc, argv, nullptr);
+		return result;
+	}
+
+	// keeps parsing after recoverable errors (skipping to the next arg) and records up to n errors
+	template <std::size_t n, typename char_t>
+	static result<app, char_t, n> parse_all(int argc, const char_t** argv)
+	{
+		result<app, char_t, n> result;
+		_ARGLESS_CORE args<char_t> args;
+		_ARGLESS_CORE parse_entry(result, args, argc, argv, nullptr);
+		return result;
+	}
+
+	// tokens which are not args/pages (or their values) are written to rest in order, without copying,
+	// rest must have room for argc entries and is nullptr terminated (ready for execv)
+	template <typename char_t>
+	static result<app, char_t> parse_known(int argc, const char_t** argv, const char_t** rest, std::size_t* rest_count = nullptr)
+	{
+		result<app, char_t> result;
+		_ARGLESS_CORE args<char_t> args;
+		std::size_t count = _ARGLESS_CORE parse_entry(result, args, argc, argv, rest);
+		if (rest_count) *rest_count = count;
+		return result;
+	}
+
+	// lines: range of argv spans (std::size + std::data), results are in input order
+	template <typename lines_t>
+	static auto parse_batch(const lines_t& lines, std::size_t thread_count = 0)
+	{
+		return _ARGLESS_CORE batch<app, lines_t>::parse(lines, thread_count);
+	}
+
+	template <typename lines_t>
+	static auto validate_batch(const lines_t& lines, std::size_t thread_count = 0)
+	{
+		return _ARGLESS_CORE batch<app, lines_t>::validate(lines, thread_count);
+	}
+};
+
+// keeps token table and result storage between parse calls (REPL/server workloads)
+template <_ARGLESS_CORE app_t app, typename char_t>
+struct parser_context
+{
+public:
+	inline parser_context() = default;
+	inline parser_context(const parser_context&) = default;
+	inline parser_context(parser_context&&) = default;
+	inline parser_context& operator=(const parser_context&) = default;
+	inline parser_context& operator=(parser_context&&) = default;
+	inline ~parser_context() = default;
+
+public:
+	inline result<app, char_t> parse(int argc, const char_t** argv)
+	{
+		result<app, char_t> result;
+		_ARGLESS_CORE parse_entry(result, m_args, argc, argv, nullptr);
+		return result;
+	}
 
-		result.m_error.m_type = result_error_type::none;
+	template <std::size_t error_capacity>
+	inline result<app, char_t, error_capacity>& parse_into(result<app, char_t, error_capacity>& result, int argc, const char_t** argv)
+	{
+		_ARGLESS_CORE parse_entry(result, m_args, argc, argv, nullptr);
+		return result;
+	}
+
+	inline result<app, char_t> parse_known(int argc, const char_t** argv, const char_t** rest, std::size_t* rest_count = nullptr)
+	{
+		result<app, char_t> result;
+		std::size_t count = _ARGLESS_CORE parse_entry(result, m_args, argc, argv, rest);
+		if (rest_count) *rest_count = count;
 		return result;
 	}
+
+private:
+	_ARGLESS_CORE args<char_t> m_args;
 };
 
 _ARGLESS_END
@@ -3062,6 +4533,10 @@ struct parser<rename<t, new_name>>
 
 	template <typename char_t>
 	static constexpr inline auto name = _ARGLESS_CORE str_cast<char_t, new_name>();
+
+	template <typename char_t>
+		requires requires { parser<t>::template completions<char_t>; }
+	static constexpr inline auto completions = parser<t>::template completions<char_t>;
 };
 
 template <typename t>
@@ -3081,6 +4556,10 @@ struct parser<force<t>>
 
 	template <typename char_t>
 	static constexpr inline auto name = parser<t>::template name<char_t>;
+
+	template <typename char_t>
+		requires requires { parser<t>::template completions<char_t>; }
+	static constexpr inline auto completions = parser<t>::template completions<char_t>;
 };
 
 template <typename t, auto value>
@@ -3094,8 +4573,8 @@ struct parser<fallback<t, value>>
 		auto result = parser<t>::template parse<char_t>(args);
 		if (!result.is_valid())
 		{
-			if constexpr (std::is_invocable_v<decltype(value)>) return t(value());
-			else return t(value);
+			if constexpr (std::is_invocable_v<decltype(value)>) return type(t(value()));
+			else return type(t(value));
 		}
 
 		return result;
@@ -3103,6 +4582,10 @@ struct parser<fallback<t, value>>
 
 	template <typename char_t>
 	static constexpr inline auto name = parser<t>::template name<char_t>;
+
+	template <typename char_t>
+		requires requires { parser<t>::template completions<char_t>; }
+	static constexpr inline auto completions = parser<t>::template completions<char_t>;
 };
 
 template <auto lambda>
@@ -3123,6 +4606,10 @@ struct parser<transform<lambda>>
 
 	template <typename char_t>
 	static constexpr inline auto name = parser<t>::template name<char_t>;
+
+	template <typename char_t>
+		requires requires { parser<t>::template completions<char_t>; }
+	static constexpr inline auto completions = parser<t>::template completions<char_t>;
 };
 
 template <auto lambda>
@@ -3145,6 +4632,10 @@ struct parser<validate<lambda>>
 
 	template <typename char_t>
 	static constexpr inline auto name = parser<type>::template name<char_t>;
+
+	template <typename char_t>
+		requires requires { parser<type>::template completions<char_t>; }
+	static constexpr inline auto completions = parser<type>::template completions<char_t>;
 };
 
 template <>
@@ -3195,40 +4686,610 @@ struct parser<option<names...>>
 	template <typename char_t>
 	static constexpr inline auto name = vs::pop_front::invoke_pipe([]<typename t>(auto str){ return [](){ return or_name<decltype(str){}(), (str_from<char_t, "'">() + str_cast<char_t, t::value>() + str_from<char_t, "'">())>(); }; },
 		[](){ return str_from<char_t, "'">() + str_cast<char_t, vs::front::value>() + str_from<char_t, "'">(); })();
+
+	template <typename char_t>
+	static constexpr inline completion_list<char_t, sizeof...(names)> completions = { static_str<str_cast<char_t, names>()>.data()... };
+};
+
+_ARGLESS_CORE_END
+
+_ARGLESS_CORE_BEGIN
+
+// with ARGLESS_COMPACT_CORE apps and pages without sub pages or abbreviations are parsed by one loop per char type,
+// every arg is reduced to a descriptor whose functions only depend on the arg type, so apps share them
+// (define it for the whole program, parse code of an app differs with it)
+
+template <typename char_t>
+struct compact_arg
+{
+	const char_t* m_name = nullptr;
+	const char_t* m_type = nullptr;
+	const char_t* m_negated = nullptr; // first "--no-" name, negated tokens point at it
+
+	// inserts flag or parsed value into the storage, on invalid value expected names the expected type
+	result_error_type (*m_store)(void* storage, args<char_t>& args, bool negated, const char_t*& expected) = nullptr;
+	bool (*m_skip)(args<char_t>& args) = nullptr; // non-winning occurrence of first/last wins arg with a value
+	void (*m_reset)(void* storage) = nullptr;
+	bool (*m_finish)(void* storage) = nullptr; // false when a required arg is missing, fills default values
+
+	repeat_policy m_repeat = repeat_policy::error;
+	bool m_terminal = false;
+};
+
+template <typename char_t>
+struct compact_group
+{
+	const std::uint64_t* m_mask = nullptr;
+	bool (*m_check)(std::size_t present) = nullptr;
+	result_error_type m_error = result_error_type::none;
+	const char_t* m_name = nullptr;
+};
+
+template <typename char_t>
+struct compact_table
+{
+	const compact_arg<char_t>* m_args;
+	std::size_t m_count;
+	const name_entry<char_t>* m_names; // sorted by code units
+	std::size_t m_name_count;
+	const name_entry<char_t>* m_shorts; // "-c" names by ascii c
+	compact_arg<char_t> m_noname; // no m_store when noname arg is void
+	compact_arg<char_t> m_noname_opened; // noname arg after "--", merges continued nonames
+	const compact_group<char_t>* m_groups;
+	std::size_t m_group_count;
+	std::size_t m_presence_words;
+	const char_t* (*m_suggest)(const char_t*);
+	bool m_terminal; // any arg is terminal
+	bool m_picked; // any arg is first/last wins
+};
+
+// per call storage of one result
+template <typename char_t>
+struct compact_state
+{
+	void* const* m_values;
+	void* m_noname;
+	std::uint64_t* m_presence;
+	std::size_t* m_picked;
+	const char_t** m_path;
+	result_error<char_t>* m_errors;
+	std::size_t m_capacity;
+	std::size_t* m_error_count;
+};
+
+template <typename t, bool merge, typename char_t>
+inline result_error_type compact_store(void* storage, args<char_t>& args, [[maybe_unused]] bool negated, [[maybe_unused]] const char_t*& expected)
+{
+	using type = parse_cast<t>;
+	auto& value = *static_cast<result_cast<t>*>(storage);
+	auto insert = [&](auto&&... as) -> result_error_type {
+		bool inserted;
+		if constexpr (merge)
+			inserted = result_merge<t>::call(value, std::forward<decltype(as)>(as)...);
+		else
+			inserted = result_insert<t>::call(value, std::forward<decltype(as)>(as)...);
+		return inserted ? result_error_type::none : result_error_type::ambiguous_arg_value;
+	};
+
+	if constexpr (is_negatable<t>::value)
+		if (negated)
+			return insert(false);
+
+	if constexpr (std::is_void_v<type>)
+		return insert();
+	else
+	{
+		auto presult = parser<type>::template parse<char_t>(args);
+		if (!presult.is_valid())
+		{
+			expected = presult.expected().what();
+			return result_error_type::invalid_arg_value;
+		}
+		return insert(std::move(presult).get());
+	}
+}
+
+template <typename t, typename char_t>
+inline bool compact_skip(args<char_t>& args) { return parse_skip<parse_cast<t>>(args); }
+
+template <typename t>
+inline void compact_reset(void* storage) { result_reset<t>::call(*static_cast<result_cast<t>*>(storage)); }
+
+template <typename t>
+inline bool compact_finish(void* storage)
+{
+	auto& value = *static_cast<result_cast<t>*>(storage);
+	if constexpr (is_required<t>::value)
+		return static_cast<bool>(value);
+	else
+	{
+		if (!value)
+		{
+			if constexpr (std::is_convertible_v<decltype(t::value), typename parser<parse_cast<t>>::type>)
+				value = t::value;
+			else
+				value = t::value();
+		}
+		return true;
+	}
+}
+
+template <typename t, typename char_t, repeat_policy repeat = repeat_policy::error>
+inline constexpr compact_arg<char_t> make_compact_arg(const char_t* name, const char_t* negated)
+{
+	compact_arg<char_t> arg;
+	arg.m_name = name;
+	arg.m_type = get_name<parse_cast<t>, char_t>();
+	arg.m_negated = negated;
+	arg.m_store = &compact_store<t, repeat == repeat_policy::merge, char_t>;
+	if constexpr (!std::is_void_v<parse_cast<t>>)
+		arg.m_skip = &compact_skip<t, char_t>;
+	arg.m_reset = &compact_reset<t>;
+	if constexpr (is_required<t>::value || is_default_value<t>::value)
+		arg.m_finish = &compact_finish<t>;
+	arg.m_repeat = repeat;
+	return arg;
+}
+
+// descriptor tables of an app/page, built at compile-time from parse_impl tables
+template <typename app_like, typename char_t>
+struct compact_tables
+{
+	using impl = parse_impl<app_like>;
+	using values = typename app_like::args;
+	using groups = typename app_like::groups;
+
+	static constexpr inline auto arg_table = [](){
+		std::array<compact_arg<char_t>, values::count> table{};
+		values::invoke([&]<typename t, std::size_t i>() {
+			table[i] = make_compact_arg<typename t::type, char_t, t::repeat>(static_str<str_cast<char_t, t::name>()>, impl::template negated_names<char_t>[i]);
+			table[i].m_terminal = t::terminal;
+		});
+		return table;
+	}();
+
+	static constexpr inline auto names = [](){
+		auto names = impl::template name_table<char_t>;
+		heap_sort(names.data(), names.size(), [](const name_entry<char_t>& l, const name_entry<char_t>& r) { return scmp(l.m_name, r.m_name) < 0; });
+		return names;
+	}();
+
+	static constexpr inline auto group_table = [](){
+		std::array<compact_group<char_t>, groups::count> table{};
+		groups::invoke([&]<typename t, std::size_t i>() {
+			table[i] = { impl::template group_mask<t>.data(), &group_impl<t>::check, group_impl<t>::error, static_str<group_name<t, char_t>> };
+		});
+		return table;
+	}();
+
+	static constexpr inline compact_arg<char_t> noname = [](){
+		if constexpr (std::is_void_v<typename app_like::noname_arg_type>)
+			return compact_arg<char_t>();
+		else
+			return make_compact_arg<typename app_like::noname_arg_type, char_t>(nullptr, nullptr);
+	}();
+
+	static constexpr inline compact_arg<char_t> noname_opened = [](){
+		if constexpr (continued_noname<typename app_like::noname_arg_type>)
+			return make_compact_arg<typename app_like::noname_arg_type, char_t, repeat_policy::merge>(nullptr, nullptr);
+		else
+			return noname;
+	}();
+
+	static constexpr inline compact_table<char_t> table = {
+		arg_table.data(), arg_table.size(),
+		names.data(), names.size(),
+		impl::template short_table<char_t>.data(),
+		noname,
+		noname_opened,
+		group_table.data(), group_table.size(),
+		impl::presence_words,
+		&impl::template suggest<char_t>,
+		impl::has_terminal,
+		impl::has_picked,
+	};
+};
+
+template <typename char_t>
+struct compact_core
+{
+	struct sink
+	{
+		result_error<char_t>* m_errors;
+		std::size_t m_capacity;
+		std::size_t m_count = 0;
+
+		inline result_error<char_t>& next() { return m_errors[m_count] = result_error<char_t>(); }
+		inline bool commit() { return ++m_count < m_capacity; }
+	};
+
+	// exact match by binary search, negated names are replaced by the first "--no-" name of their arg
+	static inline void find(const compact_table<char_t>& table, typename args<char_t>::arg& arg)
+	{
+		std::size_t first = 0, last = table.m_name_count;
+		while (first < last)
+		{
+			std::size_t mid = first + (last - first) / 2;
+			int cmp = scmp(table.m_names[mid].m_name, arg.m_value);
+			if (!cmp)
+			{
+				auto& entry = table.m_names[mid];
+				arg.m_arg = entry.m_arg;
+				if (entry.m_negated)
+					arg.m_value = table.m_args[entry.m_arg - 1].m_negated;
+				return;
+			}
+			if (cmp < 0) first = mid + 1;
+			else last = mid;
+		}
+	}
+
+	static inline bool is_terminal(const compact_table<char_t>& table, std::size_t arg)
+	{
+		return arg && arg <= table.m_count && table.m_args[arg - 1].m_terminal;
+	}
+
+	// same as parse_impl::classify without pages and abbreviations
+	static inline void classify(const compact_table<char_t>& table, args<char_t>& args, std::size_t from, bool values_only = false)
+	{
+		for (std::size_t i = from; i < args.m_limit; ++i)
+		{
+			find(table, args.m_args[i]);
+			std::size_t added = args.m_args[i].m_arg ? 0 : split_token(args, i, table.m_names, table.m_name_count, table.m_shorts);
+
+			if (table.m_terminal)
+			{
+				if (values_only)
+				{
+					if (args.m_args[i].m_arg)
+					{
+						args.m_limit = i + 1;
+						return;
+					}
+				}
+				else
+					for (std::size_t k = i; k <= i + added; ++k)
+						if (is_terminal(table, args.m_args[k].m_arg))
+						{
+							args.m_terminal = k + 1;
+							for (std::size_t v = k + 1; v <= i + added; ++v)
+								if (args.m_args[v].m_arg)
+								{
+									args.m_limit = v + 1;
+									return;
+								}
+							classify(table, args, i + added + 1, true);
+							return;
+						}
+			}
+
+			i += added;
+		}
+	}
+
+	static inline void pick(const compact_table<char_t>& table, const compact_state<char_t>& state, const args<char_t>& args)
+	{
+		for (std::size_t k = args.m_index; k < args.m_limit; ++k)
+		{
+			std::size_t arg = args.m_args[k].m_arg;
+			if (!arg || arg > table.m_count) continue;
+			auto repeat = table.m_args[arg - 1].m_repeat;
+			if (repeat == repeat_policy::last_wins || (repeat == repeat_policy::first_wins && !state.m_picked[arg - 1]))
+				state.m_picked[arg - 1] = k + 1;
+		}
+	}
+
+	// true on error
+	static inline bool store(const compact_table<char_t>& table, const compact_arg<char_t>& desc, void* storage, sink& sink, args<char_t>& args, bool negated)
+	{
+		const char_t* expected = nullptr;
+		auto type = desc.m_store(storage, args, negated, expected);
+		if (type == result_error_type::none)
+			return false;
+
+		auto& error = sink.next();
+		error.m_type = type;
+		error.m_arg_index = args.m_index;
+		error.m_arg_name = desc.m_name;
+		error.m_arg_type = desc.m_type;
+		if (type == result_error_type::invalid_arg_value)
+		{
+			error.m_index = args.m_index;
+			error.m_expected_type = expected;
+			// at m_limit (e.g. "--name -- x") the value is missing, "--" is not reported as one
+			if (args.m_index < args.m_limit && !args.m_args[args.m_index].m_arg)
+			{
+				error.m_value = args.m_args[args.m_index].m_value;
+				error.m_suggest = table.m_suggest;
+			}
+		}
+		return true;
+	}
+
+	// same as parse_impl::run without pages and abbreviations
+	static inline bool run(const compact_table<char_t>& table, const compact_state<char_t>& state, sink& sink, args<char_t>& args)
+	{
+		if (table.m_picked)
+			pick(table, state, args);
+
+		// tokens before a terminal arg are not parsed
+		if (args.m_terminal > args.m_index)
+			args.m_index = args.m_terminal - 1;
+
+		bool opened = false;
+		while (args.m_index < args.m_limit || (opened = end_of_options(args)))
+		{
+			std::size_t at = args.m_index;
+			auto& arg = args.m_args[at];
+			bool failed = false;
+
+			if (arg.m_arg)
+			{
+				std::size_t i = arg.m_arg - 1;
+				auto& desc = table.m_args[i];
+				if (table.m_group_count)
+					state.m_presence[i / 64] |= std::uint64_t(1) << (i % 64);
+
+				args.consume();
+				bool negated = desc.m_negated && arg.m_value == desc.m_negated;
+				if ((desc.m_repeat == repeat_policy::first_wins || desc.m_repeat == repeat_policy::last_wins) && state.m_picked[i] != at + 1)
+				{
+					if (desc.m_skip && !negated)
+						desc.m_skip(args);
+				}
+				else
+					failed = store(table, desc, state.m_values[i], sink, args, negated);
+			}
+			else if (args.m_rest)
+			{
+				args.m_rest[args.m_rest_count++] = arg.m_value;
+				args.consume();
+			}
+			else if (table.m_noname.m_store)
+			{
+				failed = store(table, opened ? table.m_noname_opened : table.m_noname, state.m_noname, sink, args, false);
+			}
+			else
+			{
+				auto& error = sink.next();
+				error.m_type = result_error_type::stray_value;
+				error.m_index = at;
+				error.m_value = arg.m_value;
+				error.m_suggest = table.m_suggest;
+				failed = true;
+			}
+
+			if (failed)
+			{
+				if (!sink.commit()) return false;
+				while (args.m_index < args.m_limit && !args.m_args[args.m_index].m_arg)
+					args.consume();
+			}
+
+			// terminal arg, required args and groups are not checked
+			if (args.m_terminal)
+				return true;
+		}
+
+		for (std::size_t i = 0; i < table.m_count; ++i)
+		{
+			auto& desc = table.m_args[i];
+			if (desc.m_finish && !desc.m_finish(state.m_values[i]))
+			{
+				auto& error = sink.next();
+				error.m_type = result_error_type::missing_arg;
+				error.m_arg_name = desc.m_name;
+				error.m_arg_type = desc.m_type;
+				if (!sink.commit()) return false;
+			}
+		}
+
+		for (std::size_t g = 0; g < table.m_group_count; ++g)
+		{
+			auto& group = table.m_groups[g];
+			std::size_t present = 0;
+			for (std::size_t i = 0; i < table.m_presence_words; ++i)
+				present += std::popcount(state.m_presence[i] & group.m_mask[i]);
+
+			if (group.m_check(present)) continue;
+			auto& error = sink.next();
+			error.m_type = group.m_error;
+			error.m_arg_name = group.m_name;
+			if (!sink.commit()) return false;
+		}
+
+		return true;
+	}
+
+	static inline std::size_t parse_into(const compact_table<char_t>& table, const compact_state<char_t>& state, args<char_t>& args, int argc, const char_t** argv, const char_t** rest)
+	{
+		tokenize(args, argc, argv, rest);
+		// argv[0] is the path, never an arg
+		classify(table, args, 1);
+
+		*state.m_path = nullptr;
+		if (table.m_noname.m_reset)
+			table.m_noname.m_reset(state.m_noname);
+		for (std::size_t i = 0; i < table.m_count; ++i)
+			table.m_args[i].m_reset(state.m_values[i]);
+
+		if (auto path = args.peak())
+			*state.m_path = (args.consume(), *path);
+
+		sink sink{ state.m_errors, state.m_capacity };
+		run(table, state, sink, args);
+		if (!(*state.m_error_count = sink.m_count))
+			state.m_errors[0] = result_error<char_t>();
+
+		if (rest)
+			rest[args.m_rest_count] = nullptr;
+		return args.m_rest_count;
+	}
 };
 
 _ARGLESS_CORE_END
-#include <sstream>
+#include <string>
+#include <string_view>
+
+#if defined(_WIN32)
+#include <io.h>
+#elif __has_include(<unistd.h>)
+#include <unistd.h>
+#define _ARGLESS_HAS_UNISTD
+#endif
+
+_ARGLESS_CORE_BEGIN
+
+// writes chars [m_offset, m_offset + m_capacity) of the formatted text to m_out and counts all of them,
+// so text can be sized first and filled (or written in chunks) without allocation, also in constant evaluation
+template <typename char_t>
+struct help_writer
+{
+	char_t* m_out = nullptr;
+	std::size_t m_capacity = 0;
+	std::size_t m_offset = 0;
+	std::size_t m_size = 0;
+
+	inline constexpr void put(char_t c)
+	{
+		if (m_size >= m_offset && m_size - m_offset < m_capacity)
+			m_out[m_size - m_offset] = c;
+		++m_size;
+	}
+
+	inline constexpr help_writer& operator<<(const char_t* str)
+	{
+		for (; *str; ++str)
+			put(*str);
+		return *this;
+	}
+
+	inline constexpr help_writer& operator<<(char c)
+	{
+		put(static_cast<char_t>(c));
+		return *this;
+	}
+
+	inline constexpr help_writer& operator<<(std::size_t value)
+	{
+		char digits[20];
+		std::size_t count = 0;
+		do digits[count++] = static_cast<char>('0' + value % 10); while (value /= 10);
+		while (count)
+			put(static_cast<char_t>(digits[--count]));
+		return *this;
+	}
+};
+
+template <typename char_t>
+inline constexpr void help_error_write(help_writer<char_t>& out, const result_error<char_t>& error)
+{
+	auto or_null = [](const char_t* str) -> const char_t* { return str ? str : static_str<str_from<char_t, "null">()>.data(); };
+
+	out << str_from<char_t, "error type: ">();
+	switch (error.type())
+	{
+		case argless::result_error_type::none:;
+		case argless::result_error_type::unknown: out << str_from<char_t, "unknown">(); break;
+		case argless::result_error_type::stray_value: out << str_from<char_t, "stray_value">(); break;
+		case argless::result_error_type::ambiguous_arg_value: out << str_from<char_t, "ambiguous_arg_value">(); break;
+		case argless::result_error_type::invalid_arg_value: out << str_from<char_t, "invalid_arg_value">(); break;
+		case argless::result_error_type::missing_arg: out << str_from<char_t, "missing_arg">(); break;
+		case argless::result_error_type::conflicting_args: out << str_from<char_t, "conflicting_args">(); break;
+		case argless::result_error_type::missing_group_arg: out << str_from<char_t, "missing_group_arg">(); break;
+		case argless::result_error_type::incomplete_group: out << str_from<char_t, "incomplete_group">(); break;
+		case argless::result_error_type::ambiguous_arg: out << str_from<char_t, "ambiguous_arg">(); break;
+	}
+	out << '\n'
+
+		<< str_from<char_t, "\twhat type: ">() << or_null(error.what_type()) << '\n'
+		<< str_from<char_t, "\twhere: ">() << error.where() << '\n'
+		<< str_from<char_t, "\twhat arg: ">() << or_null(error.what_arg()) << '\n'
+		<< str_from<char_t, "\twhat arg type: ">() << or_null(error.what_arg_type()) << '\n'
+		<< str_from<char_t, "\twhere arg: ">() << error.where_arg() << '\n';
+
+	if (auto suggestion = error.suggestion())
+		out << str_from<char_t, "\tdid you mean: ">() << suggestion << '\n';
+}
+
+#if defined(_WIN32) || defined(_ARGLESS_HAS_UNISTD)
+// retries partial writes, returns false if write fails
+inline bool write_fd(int fd, const void* data, std::size_t size)
+{
+	for (std::size_t written = 0; written < size;)
+	{
+#if defined(_WIN32)
+		auto result = ::_write(fd, static_cast<const char*>(data) + written, static_cast<unsigned int>(size - written));
+#else
+		auto result = ::write(fd, static_cast<const char*>(data) + written, size - written);
+#endif
+		if (result <= 0) return false;
+		written += static_cast<std::size_t>(result);
+	}
+	return true;
+}
+#endif
 
+_ARGLESS_CORE_END
 _ARGLESS_BEGIN
 
 template <_ARGLESS_CORE app_t app, typename char_t>
-inline constexpr std::basic_string<char_t> help_error(const result_error<char_t>& error, int argc, const char_t** argv)
+inline std::basic_string<char_t> help_error(const result_error<char_t>& error, int argc, const char_t** argv)
+{
+	(void) argc;
+	(void) argv;
+
+	_ARGLESS_CORE help_writer<char_t> size;
+	_ARGLESS_CORE help_error_write(size, error);
+
+	std::basic_string<char_t> text(size.m_size, char_t());
+	_ARGLESS_CORE help_writer<char_t> out{ text.data(), text.size() };
+	_ARGLESS_CORE help_error_write(out, error);
+	return text;
+}
+
+// snprintf like: writes at most size - 1 chars and null terminator, returns length of the whole text
+template <_ARGLESS_CORE app_t app, typename char_t>
+inline constexpr std::size_t help_error(const result_error<char_t>& error, int argc, const char_t** argv, char_t* buffer, std::size_t size)
+{
+	(void) argc;
+	(void) argv;
+
+	_ARGLESS_CORE help_writer<char_t> out{ buffer, size ? size - 1 : 0 };
+	_ARGLESS_CORE help_error_write(out, error);
+	if (size)
+		buffer[out.m_size < size - 1 ? out.m_size : size - 1] = char_t();
+	return out.m_size;
+}
+
+#if defined(_WIN32) || defined(_ARGLESS_HAS_UNISTD)
+// formats through a stack buffer straight to fd, no allocation, returns false if write fails
+template <_ARGLESS_CORE app_t app, typename char_t>
+	requires (sizeof(char_t) == 1)
+inline bool help_error_fd(const result_error<char_t>& error, int argc, const char_t** argv, int fd)
 {
 	(void) argc;
 	(void) argv;
-	std::basic_stringstream<char_t> out;
 
-	out << "error type: ";
-	switch (error.type())
+	char_t buffer[256];
+	std::size_t offset = 0;
+	while (true)
 	{
-		case argless::result_error_type::none:;
-		case argless::result_error_type::unknown: out << "unknown"; break;
-		case argless::result_error_type::stray_value: out << "stray_value"; break;
-		case argless::result_error_type::ambiguous_arg_value: out << "ambiguous_arg_value"; break;
-		case argless::result_error_type::invalid_arg_value: out << "invalid_arg_value"; break;
-		case argless::result_error_type::missing_arg: out << "missing_arg"; break;
-	}
-	out << '\n' 
+		_ARGLESS_CORE help_writer<char_t> out{ buffer, sizeof(buffer), offset };
+		_ARGLESS_CORE help_error_write(out, error);
 
-		<< "\twhat type: " << (error.what_type() ? error.what_type() : "null") << '\n'
-		<< "\twhere: " << error.where() << '\n'
-		<< "\twhat arg: " << (error.what_arg() ? error.what_arg() : "null") << '\n'
-		<< "\twhat arg type: " << (error.what_arg_type() ? error.what_arg_type() : "null") << '\n'
-		<< "\twhere arg: " << error.where_arg() << '\n';
+		std::size_t count = out.m_size - offset < sizeof(buffer) ? out.m_size - offset : sizeof(buffer);
+		if (!_ARGLESS_CORE write_fd(fd, buffer, count))
+			return false;
 
-	return out.str();
+		offset += count;
+		if (offset >= out.m_size) return true;
+	}
 }
+#endif
+
+_ARGLESS_END
+_ARGLESS_CORE_BEGIN
 
 /*
  * ARG::NAME \(ARGS::RQUIRED ? "(Required)" : "")    \t   Type: ARG::TYPE
@@ -3236,13 +5297,34 @@ inline constexpr std::basic_string<char_t> help_error(const result_error<char_t>
  *
  */
 
-template <_ARGLESS_CORE app_t app, typename char_t = char>
-inline std::basic_string<char_t> help_arg(const char_t* arg)
-{
-	(void) arg;
-	std::basic_stringstream<char_t> out;
-	out << "TODO";
-	return out.str();
+template <typename t, typename char_t>
+inline constexpr void help_arg_write(help_writer<char_t>& out, bool indent)
+{
+	if (indent) out << '\t';
+	out << str_cast<char_t, t::name>();
+	if constexpr (!page_t<t>)
+		if constexpr (is_negatable<typename t::type>::value && is_long_name<t::name>)
+			out << str_from<char_t, ", ">() << str_cast<char_t, negated_name<t::name>()>();
+	if constexpr (!page_t<t>)
+		if constexpr (is_required<typename t::type>::value)
+			out << str_from<char_t, " (Required)">();
+
+	out << '\t' << str_from<char_t, "Type: ">();
+	if constexpr (page_t<t>)
+		out << str_from<char_t, "page">();
+	else
+		out << get_name<parse_cast<typename t::type>, char_t>();
+	out << '\n';
+
+	if constexpr (tetter_from<decltype(t::aliases)>::count || t::desc.size() > 1)
+	{
+		if (indent) out << '\t';
+		tetter_sequence<tetter_from<decltype(t::aliases)>::count>::invoke([&]<std::size_t i>(){
+			if constexpr (i) out << str_from<char_t, ", ">();
+			out << str_cast<char_t, std::get<i>(t::aliases)>();
+		});
+		out << '\t' << str_cast<char_t, t::desc>() << '\n';
+	}
 }
 
 /*
@@ -3259,31 +5341,403 @@ inline std::basic_string<char_t> help_arg(const char_t* arg)
  * \t ARG::NAME      \t   Type: ARG::TYPE
  * \t ARG::ALIASES   \t   ARG::DESC
  *
+ * Pages:
+ * \t PAGE::NAME     \t   Type: page
+ * \t                \t   PAGE::DESC
+ *
+ * Groups:
+ * \t GROUP::KIND: GROUP::NAMES
+ *
  */
 
+template <typename app, typename char_t>
+inline constexpr void help_app_write(help_writer<char_t>& out)
+{
+	using args = typename app::args;
+	using groups = typename app::groups;
+
+	constexpr auto is_required_arg = []<typename t, std::size_t>() {
+		if constexpr (page_t<t>) return false;
+		else return is_required<typename t::type>::value;
+	};
+	constexpr auto is_other_arg = []<typename t, std::size_t>() {
+		if constexpr (page_t<t>) return false;
+		else return !is_required<typename t::type>::value;
+	};
+
+	using required_args = typename args::template filter_l<is_required_arg>;
+	using other_args = typename args::template filter_l<is_other_arg>;
+	using pages = typename args::template filter_l<[]<typename t, std::size_t>() { return page_t<t>; }>;
+
+	out << str_cast<char_t, app::name>() << '\n';
+	if constexpr (app::desc.size() > 1)
+		out << '\t' << str_cast<char_t, app::desc>() << '\n';
+
+	if constexpr (required_args::count)
+	{
+		out << '\n' << str_from<char_t, "Required:">() << '\n';
+		required_args::invoke([&]<typename t>() { help_arg_write<t>(out, true); });
+	}
+
+	if constexpr (other_args::count)
+	{
+		if constexpr (required_args::count)
+			out << '\n' << str_from<char_t, "Other:">() << '\n';
+		else
+			out << '\n' << str_from<char_t, "Args:">() << '\n';
+		other_args::invoke([&]<typename t>() { help_arg_write<t>(out, true); });
+	}
+
+	if constexpr (pages::count)
+	{
+		out << '\n' << str_from<char_t, "Pages:">() << '\n';
+		pages::invoke([&]<typename t>() { help_arg_write<t>(out, true); });
+	}
+
+	if constexpr (groups::count)
+	{
+		out << '\n' << str_from<char_t, "Groups:">() << '\n';
+		groups::invoke([&]<typename t>() {
+			out << '\t';
+			if constexpr (group_impl<t>::error == result_error_type::conflicting_args)
+				out << str_from<char_t, "exclusive: ">();
+			else if constexpr (group_impl<t>::error == result_error_type::missing_group_arg)
+				out << str_from<char_t, "at least one: ">();
+			else
+				out << str_from<char_t, "all or none: ">();
+			out << group_name<t, char_t> << '\n';
+		});
+	}
+}
+
+// whole help text as a static str (single write of rodata at runtime)
+template <typename app, typename char_t>
+constexpr inline auto help_app_str = [](){
+	constexpr std::size_t size = [](){ help_writer<char_t> out; help_app_write<app>(out); return out.m_size; }();
+	str<char_t, size + 1> text;
+	help_writer<char_t> out{ text.m_buffer, size };
+	help_app_write<app>(out);
+	return text;
+}();
+
+template <typename t, typename char_t>
+constexpr inline auto help_arg_str = [](){
+	constexpr std::size_t size = [](){ help_writer<char_t> out; help_arg_write<t>(out, false); return out.m_size; }();
+	str<char_t, size + 1> text;
+	help_writer<char_t> out{ text.m_buffer, size };
+	help_arg_write<t>(out, false);
+	return text;
+}();
+
+// "--no-" spelling of a long name or alias of a negatable arg
+template <typename app, typename t, typename char_t>
+inline constexpr bool help_negated(const char_t* arg)
+{
+	if constexpr (parse_impl<app>::template negatable_arg<t>)
+	{
+		bool found = false;
+		if constexpr (is_long_name<t::name>)
+			found = seq(static_str<str_cast<char_t, negated_name<t::name>()>()>.data(), arg);
+		tetter_sequence<tetter_from<decltype(t::aliases)>::count>::invoke([&]<std::size_t a>() {
+			if constexpr (is_long_name<std::get<a>(t::aliases)>)
+				found = found || seq(static_str<str_cast<char_t, negated_name<std::get<a>(t::aliases)>()>()>.data(), arg);
+		});
+		return found;
+	}
+	else
+		return false;
+}
+
+_ARGLESS_CORE_END
+_ARGLESS_BEGIN
+
+// views of the static help text, empty if arg is not a name, alias or "--no-" name of app args
+template <_ARGLESS_CORE app_t app, typename char_t = char>
+inline constexpr std::basic_string_view<char_t> help_arg_text(const char_t* arg)
+{
+	return app::args::invoke_pipe([&]<typename t>(std::basic_string_view<char_t> text) -> std::basic_string_view<char_t> {
+		if (!text.empty()) return text;
+		if (_ARGLESS_CORE seq(t::name.data(), arg) ||
+			tetter_sequence<tetter_from<decltype(t::aliases)>::count>::invoke_any([&]<std::size_t i>() {
+				return _ARGLESS_CORE seq(std::get<i>(t::aliases).data(), arg);
+			}) ||
+			_ARGLESS_CORE help_negated<app, t>(arg))
+			return { _ARGLESS_CORE help_arg_str<t, char_t>.data(), _ARGLESS_CORE help_arg_str<t, char_t>.size() - 1 };
+		return text;
+	}, std::basic_string_view<char_t>());
+}
+
+template <_ARGLESS_CORE app_t app, typename char_t = char>
+inline constexpr std::basic_string_view<char_t> help_app_text()
+{
+	return { _ARGLESS_CORE help_app_str<app, char_t>.data(), _ARGLESS_CORE help_app_str<app, char_t>.size() - 1 };
+}
+
+template <_ARGLESS_CORE app_t app, typename char_t = char>
+inline constexpr std::basic_string<char_t> help_arg(const char_t* arg)
+{
+	return std::basic_string<char_t>(help_arg_text<app, char_t>(arg));
+}
+
 template <_ARGLESS_CORE app_t app, typename char_t = char>
 inline constexpr std::basic_string<char_t> help_app()
 {
-	std::basic_stringstream<char_t> out;
+	return std::basic_string<char_t>(help_app_text<app, char_t>());
+}
 
-	out << _ARGLESS_CORE str_cast<char_t, app::name>() << '\n'; 
-	out << _ARGLESS_CORE str_cast<char_t, app::desc>() << '\n';
+_ARGLESS_END
 
-	app::args::invoke([&]<typename t>(){
-		out << '\n'; 
-		out << _ARGLESS_CORE str_cast<char_t, t::name>(); 
-		tetter_sequence<tetter_from<decltype(t::aliases)>::count>::invoke([&]<std::size_t i>(){
-			out << _ARGLESS_CORE str_from<char_t, ", ">() << _ARGLESS_CORE str_cast<char_t, std::get<i>(t::aliases)>(); 
+_ARGLESS_BEGIN
+
+enum class completion_shell
+{
+	bash,
+	zsh,
+	fish,
+};
+
+_ARGLESS_END
+_ARGLESS_CORE_BEGIN
+
+// classifies words up to the cursor only, values are never converted or validated
+template <typename app_like>
+struct complete_impl
+{
+	using impl = parse_impl<app_like>;
+	using values = typename app_like::args;
+
+	// arg of "--name=value" or of the last short of a "-abc" cluster which takes a value (like split_token),
+	// attached is set to its value part in the token, nullptr if the value is the next token
+	template <typename char_t>
+	static inline std::size_t find_attached(const char_t* value, const char_t*& attached)
+	{
+		attached = nullptr;
+		if (value[0] != '-' || !value[1])
+			return 0;
+
+		for (const char_t* it = value + 1; *it; ++it)
+			if (*it == '=')
+			{
+				for (auto& entry : impl::template name_table<char_t>)
+					if (entry.m_value && entry.m_size == static_cast<std::size_t>(it - value) && seq_n(entry.m_name, value, entry.m_size))
+					{
+						attached = it + 1;
+						return entry.m_arg;
+					}
+				return 0;
+			}
+
+		if (value[1] == '-')
+			return 0;
+
+		auto& shorts = impl::template short_table<char_t>;
+		for (const char_t* it = value + 1; *it; ++it)
+		{
+			if (static_cast<char32_t>(*it) >= 128 || !shorts[static_cast<char32_t>(*it)].m_arg)
+				return 0;
+			if (shorts[static_cast<char32_t>(*it)].m_value)
+			{
+				if (it[1]) attached = it + 1;
+				return shorts[static_cast<char32_t>(*it)].m_arg;
+			}
+		}
+		return 0;
+	}
+
+	// arg is not a flag, the word after it is its value
+	static inline bool takes_value(std::size_t arg)
+	{
+		bool value = false;
+		values::invoke([&]<typename t, std::size_t t_i>() {
+			if constexpr (!page_t<t>)
+				if constexpr (!std::is_void_v<parse_cast<typename t::type>>)
+					if (t_i == arg - 1)
+						value = true;
 		});
-		out << '\n' << "type: ";
-		out << get_name<_ARGLESS_CORE parse_cast<typename t::type>, char_t>();
-		out << '\n';
-		out << _ARGLESS_CORE str_cast<char_t, t::desc>();
-		out << '\n';
+		return value;
+	}
+
+	// last word is the one under the cursor (may be empty)
+	template <typename char_t, typename emit_t>
+	static inline void run(const char_t* const* words, std::size_t count, emit_t& emit)
+	{
+		std::size_t last = 0;
+		const char_t* attached = nullptr;
+		for (std::size_t i = 0; i + 1 < count; ++i)
+		{
+			// words after "--" are values only, there is nothing to offer
+			if (words[i][0] == '-' && words[i][1] == '-' && !words[i][2])
+				return;
+
+			bool waiting = last && takes_value(last);
+			if ((last = impl::find_arg(words[i])))
+				continue;
+
+			// "-vj" waits for the value of -j, "-j8" and "--name=value" already have it
+			if ((last = find_attached(words[i], attached)) && attached)
+				last = 0;
+			if (last)
+				continue;
+
+			// value of the arg before it ("-o build"), never a page
+			if (waiting)
+				continue;
+
+			if constexpr (impl::has_pages)
+				if (std::size_t page = impl::find_page(words[i]))
+				{
+					values::invoke([&]<typename t, std::size_t t_i>() {
+						if constexpr (page_t<t>)
+							if (t_i == page - 1)
+								complete_impl<t>::run(words + i + 1, count - i - 1, emit);
+					});
+					return;
+				}
+		}
+
+		const char_t empty[1] = {};
+		const char_t* current = count ? words[count - 1] : empty;
+
+		// value typed in the current word ("--name=va", "-vjva"), candidates keep the part before it
+		const char_t* value_begin = current;
+		if (std::size_t arg = find_attached(current, attached); arg && attached)
+		{
+			last = arg;
+			value_begin = attached;
+		}
+
+		// value of the arg before cursor
+		bool value = false;
+		if (last)
+			values::invoke([&]<typename t, std::size_t t_i>() {
+				if constexpr (!page_t<t>)
+				{
+					using type = parse_cast<typename t::type>;
+					if constexpr (!std::is_void_v<type>)
+						if (t_i == last - 1)
+						{
+							value = true;
+							if constexpr (requires { parser<type>::template completions<char_t>; })
+							{
+								std::basic_string<char_t> joined(current, value_begin);
+								for (auto completion : parser<type>::template completions<char_t>)
+									if (sprefix(value_begin, completion))
+									{
+										if (value_begin == current)
+											emit(completion);
+										else
+										{
+											joined.resize(static_cast<std::size_t>(value_begin - current));
+											joined += completion;
+											emit(joined.c_str());
+										}
+									}
+							}
+						}
+				}
+			});
+		if (value) return;
+
+		for (auto& entry : impl::template name_table<char_t>)
+			if (sprefix(current, entry.m_name)) emit(entry.m_name);
+	}
+};
+
+/*
+ * scripts call "APP::NAME __complete WORDS... CURRENT" and use printed lines as candidates,
+ * shell falls back to file completion when there are none
+ */
+
+template <typename app, completion_shell shell>
+inline constexpr void completion_script_write(help_writer<char>& out)
+{
+	constexpr auto name = str_cast<char, app::name>();
+
+	if constexpr (shell == completion_shell::bash)
+	{
+		// COMP_WORDS splits "--name=value" at '=', words are taken from the line and the part of the
+		// current word bash does not replace is cut from the candidates
+		out << "_argless_" << name << "() {\n"
+			<< "\tlocal IFS=$'\\n' line=\"${COMP_LINE:0:$COMP_POINT}\" words\n"
+			<< "\tIFS=$' \\t' read -ra words <<< \"$line\"\n"
+			<< "\t[[ \"$line\" == *[[:space:]] ]] && words+=(\"\")\n"
+			<< "\tlocal current=\"${words[${#words[@]}-1]}\" word=\"${COMP_WORDS[$COMP_CWORD]}\"\n"
+			<< "\tCOMPREPLY=($(\"${words[0]}\" __complete \"${words[@]:1}\" 2>/dev/null))\n"
+			<< "\tCOMPREPLY=(\"${COMPREPLY[@]#\"${current%\"$word\"}\"}\")\n"
+			<< "}\n"
+			<< "complete -o default -F _argless_" << name << ' ' << name << '\n';
+	}
+	else if constexpr (shell == completion_shell::zsh)
+	{
+		out << "#compdef " << name << '\n'
+			<< "_argless_" << name << "() {\n"
+			<< "\tlocal -a candidates\n"
+			<< "\tcandidates=(${(f)\"$(\"${words[1]}\" __complete \"${(@)words[2,CURRENT]}\" 2>/dev/null)\"})\n"
+			<< "\tif (( ${#candidates} )); then compadd -a candidates; else _files; fi\n"
+			<< "}\n"
+			<< "compdef _argless_" << name << ' ' << name << '\n';
+	}
+	else
+	{
+		out << "complete -c " << name << " -a '(" << name << " __complete (commandline -opc)[2..-1] (commandline -ct) 2>/dev/null)'\n";
+	}
+}
+
+template <typename app, completion_shell shell>
+constexpr inline auto completion_script_text = [](){
+	constexpr std::size_t size = [](){ help_writer<char> out; completion_script_write<app, shell>(out); return out.m_size; }();
+	str<char, size + 1> text;
+	help_writer<char> out{ text.m_buffer, size };
+	completion_script_write<app, shell>(out);
+	return text;
+}();
+
+_ARGLESS_CORE_END
+_ARGLESS_BEGIN
+
+// script to source/eval in shell, generated at compile-time
+template <_ARGLESS_CORE app_t app, completion_shell shell>
+inline constexpr std::string_view completion_script()
+{
+	return { _ARGLESS_CORE completion_script_text<app, shell>.data(), _ARGLESS_CORE completion_script_text<app, shell>.size() - 1 };
+}
+
+// handles "prog __complete words... current" by calling emit(const char_t*) for every candidate,
+// returns false (and does nothing) for any other invocation
+template <_ARGLESS_CORE app_t app, typename char_t, typename emit_t>
+inline bool complete(int argc, const char_t** argv, emit_t&& emit)
+{
+	if (argc < 2 || !_ARGLESS_CORE seq(argv[1], "__complete"))
+		return false;
+
+	_ARGLESS_CORE complete_impl<app>::run(argv + 2, static_cast<std::size_t>(argc - 2), emit);
+	return true;
+}
+
+#if defined(_WIN32) || defined(_ARGLESS_HAS_UNISTD)
+// candidates are written to fd one per line through a stack buffer
+template <_ARGLESS_CORE app_t app, typename char_t>
+	requires (sizeof(char_t) == 1)
+inline bool complete_fd(int argc, const char_t** argv, int fd = 1)
+{
+	char_t buffer[4096];
+	std::size_t used = 0;
+
+	bool handled = complete<app>(argc, argv, [&](const char_t* candidate) {
+		for (; *candidate; ++candidate)
+		{
+			if (used == sizeof(buffer)) _ARGLESS_CORE write_fd(fd, buffer, used), used = 0;
+			buffer[used++] = *candidate;
+		}
+		if (used == sizeof(buffer)) _ARGLESS_CORE write_fd(fd, buffer, used), used = 0;
+		buffer[used++] = '\n';
 	});
 
-	return out.str();
+	if (used)
+		_ARGLESS_CORE write_fd(fd, buffer, used);
+	return handled;
 }
+#endif
 
 _ARGLESS_END
 #if defined(ARGLESS_STDH_ALL)
@@ -3299,6 +5753,7 @@ _ARGLESS_END
 #define ARGLESS_STDH_OPTIONAL
 #define ARGLESS_STDH_VARIANT
 #define ARGLESS_STDH_TUPLE
+#define ARGLESS_STDH_THREAD
 #endif
 
 
@@ -3327,6 +5782,9 @@ struct parser<bool>
 
 	template <typename char_t>
 	static constexpr inline auto name = str_from<char_t, "boolean">();
+
+	template <typename char_t>
+	static constexpr inline completion_list<char_t, 2> completions = { static_str<str_from<char_t, "true">()>.data(), static_str<str_from<char_t, "false">()>.data() };
 };
 
 template <typename t>
@@ -3602,6 +6060,15 @@ struct parser<t<t_t, t_st>>
 			return value;
 	}
 
+	template <typename char_t>
+	static inline bool skip(args<char_t>& args)
+	{
+		bool any = false;
+		while (parse_skip<t_t>(args))
+			any = true;
+		return any;
+	}
+
 	template <typename char_t>
 	static constexpr inline auto name = array_wrap_name<type_name<t_t, char_t>()>() + str_from<char_t, "[]">();
 };
@@ -3633,6 +6100,15 @@ struct parser<std::forward_list<t_t, t_st>>
 			return value;
 	}
 
+	template <typename char_t>
+	static inline bool skip(args<char_t>& args)
+	{
+		bool any = false;
+		while (parse_skip<t_t>(args))
+			any = true;
+		return any;
+	}
+
 	template <typename char_t>
 	static constexpr inline auto name = array_wrap_name<type_name<t_t, char_t>()>() + str_from<char_t, "[]">();
 };
@@ -3790,6 +6266,13 @@ struct parser<enum_t>
 		else
 			return str();
 	}();
+
+	template <typename char_t>
+	static constexpr inline auto completions = [](){
+		completion_list<char_t, vs::count> values;
+		vs::invoke([&]<typename t, std::size_t i>() { values.m_values[i] = static_str<str_cast<char_t, t::name>()>.data(); });
+		return values;
+	}();
 };
 
 _ARGLESS_CORE_END
@@ -3829,6 +6312,14 @@ struct parser<std::basic_string<str_char, str_traits, str_alloc>>
 		}
 	}
 
+	template <typename char_t>
+	static inline bool skip(args<char_t>& args)
+	{
+		if (!args.peak())
+			return false;
+		return args.consume(), true;
+	}
+
 	template <typename char_t>
 	static constexpr inline auto name = str_from<char, "text">();
 };
@@ -3964,6 +6455,10 @@ struct parser<std::optional<opt_t>>
 
 	template <typename char_t>
 	static constexpr inline auto name = optional_name<type_name<opt_t, char_t>()>();
+
+	template <typename char_t>
+		requires requires { parser<opt_t>::template completions<char_t>; }
+	static constexpr inline auto completions = parser<opt_t>::template completions<char_t>;
 };
 
 _ARGLESS_CORE_END
@@ -4053,6 +6548,7 @@ _ARGLESS_CORE_END
 
 #if defined(ARGLESS_STDH_TUPLE) || defined(_GLIBCXX_TUPLE) || defined(_LIBCPP_TUPLE) || defined(_TUPLE_)
 
+#include <algorithm>
 #include <tuple>
 
 _ARGLESS_CORE_BEGIN
@@ -4065,33 +6561,88 @@ struct parser<std::tuple<tup_t, tup_st, tup_ts...>>
 	template <typename char_t>
 	static inline parse_result<type, char_t> parse(args<char_t>& args)
 	{
+		using rest_t = std::tuple<tup_st, tup_ts...>;
+
 		const auto from = args.m_index; 
 		const auto to = args.m_limit;
-
-		for (size_t l = args.m_limit; l >= from; --l)
+		auto peaked = args.m_peaked;
+
+		// the rest fails from every start in [scan, l], valid is the start below them when it parses there (none if not known),
+		// when the first element read up to its limit (the limit goes down one at a time) starts below are checked with as much
+		// work as it took, so a first element reading many tokens in front of a rest which never parses gives up in linear time
+		const auto none = to + 1;
+		auto scan = to + 1;
+		auto valid = none;
+		size_t scan_peaked = 0;
+
+		// limits from the end down, a limit is only tried when the first element looked at the token it cuts off
+		for (size_t l = to + 1; l-- > from;)
 		{
+			if (scan > l + 1)
+			{
+				scan = l + 1;
+				valid = none;
+			}
+
 			args.m_index = from;
 			args.m_limit = l;
+			args.m_peaked = 0;
 
 			auto result = parser<tup_t>::parse(args);
 
-			if (!result.is_valid())
-				continue;
+			const auto end = args.m_index;
+			const auto first_peaked = args.m_peaked;
+			peaked = std::max(peaked, first_peaked);
 
-			args.m_limit = to;
-			auto rest_result = parser<std::tuple<tup_st, tup_ts...>>::parse(args);
+			if (result.is_valid())
+			{
+				args.m_limit = to;
+				auto rest_result = parser<rest_t>::parse(args);
+				peaked = std::max(peaked, args.m_peaked);
 
-			if (!rest_result.is_valid())
-				continue;
+				if (rest_result.is_valid())
+				{
+					args.m_peaked = peaked;
+					if (result.is_default() && rest_result.is_default())
+						return make_default(std::tuple_cat(std::make_tuple(std::move(result.get())), std::move(rest_result.get())));
+					else
+						return std::tuple_cat(std::make_tuple(std::move(result.get())), std::move(rest_result.get()));
+				}
 
-			if (result.is_default() && rest_result.is_default())
-				return make_default(std::tuple_cat(std::make_tuple(std::move(result.get())), std::move(rest_result.get())));
-			else
-				return std::tuple_cat(std::make_tuple(std::move(result.get())), std::move(rest_result.get()));
+				if (end + 1 == scan)
+					scan = end;
+			}
+
+			if (first_peaked > l)
+			{
+				for (auto work = l + 1 - from; valid == none && scan > from && work;)
+				{
+					const auto start = scan - 1;
+					args.m_index = start;
+					args.m_limit = to;
+					args.m_peaked = 0;
+					if (parser<rest_t>::parse(args).is_valid())
+						valid = start;
+					else
+						scan = start;
+					scan_peaked = std::max(scan_peaked, args.m_peaked);
+					work -= std::min(work, std::max(args.m_peaked, start + 1) - start);
+				}
+			}
+
+			// no start left for the rest, the checks stand in for the parses of it the lower limits would make
+			if (scan == from)
+			{
+				peaked = std::max(peaked, scan_peaked);
+				break;
+			}
+
+			l = std::min(l, first_peaked);
 		}
 
 		args.m_index = from;
 		args.m_limit = to;
+		args.m_peaked = peaked;
 		return make_expected<type>;
 	}
 
@@ -4141,3 +6692,129 @@ _ARGLESS_CORE_END
 
 #endif
 
+#if defined(ARGLESS_STDH_THREAD) || defined(_GLIBCXX_THREAD) || defined(_LIBCPP_THREAD) || defined(_THREAD_)
+
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <iterator>
+
+_ARGLESS_CORE_BEGIN
+
+template <_ARGLESS_CORE app_t app, typename lines_t>
+	requires requires (const lines_t& lines) { std::size(lines); std::data(std::begin(lines)[0]); std::size(std::begin(lines)[0]); }
+struct batch<app, lines_t>
+{
+	using char_t = std::remove_cvref_t<std::remove_pointer_t<std::remove_cvref_t<decltype(*std::data(std::begin(std::declval<const lines_t&>())[0]))>>>;
+
+	// workers claim the next fixed chunk of lines from a shared atomic cursor until it passes the end
+	static constexpr inline std::size_t chunk = 64;
+
+	template <typename worker_t>
+	static inline void run(const lines_t& lines, std::size_t thread_count, worker_t&& worker)
+	{
+		const std::size_t count = std::size(lines);
+
+		if (!thread_count)
+			thread_count = std::thread::hardware_concurrency();
+		if (thread_count > (count + chunk - 1) / chunk)
+			thread_count = (count + chunk - 1) / chunk;
+		if (!thread_count)
+			thread_count = 1;
+
+		std::atomic<std::size_t> cursor = 0;
+		std::exception_ptr exception;
+		std::atomic<bool> failed = false;
+
+		auto work = [&](){
+			try
+			{
+				parser_context<app, char_t> context;
+				auto state = worker.make_state();
+				while (!failed.load(std::memory_order_relaxed))
+				{
+					std::size_t from = cursor.fetch_add(chunk, std::memory_order_relaxed);
+					if (from >= count) break;
+					std::size_t to = from + chunk < count ? from + chunk : count;
+
+					for (std::size_t i = from; i < to; ++i)
+					{
+						auto& line = std::begin(lines)[i];
+						worker(context, state, i, static_cast<int>(std::size(line)), const_cast<const char_t**>(std::data(line)));
+					}
+				}
+			}
+			catch (...)
+			{
+				if (!failed.exchange(true))
+					exception = std::current_exception();
+			}
+		};
+
+		std::vector<std::thread> threads;
+		threads.reserve(thread_count - 1);
+		try
+		{
+			for (std::size_t i = 1; i < thread_count; ++i)
+				threads.emplace_back(work);
+		}
+		catch (...)
+		{
+			// started threads stop at their next chunk and are joined, destroying them unjoined would terminate
+			failed = true;
+			for (auto& thread : threads)
+				thread.join();
+			throw;
+		}
+		work();
+		for (auto& thread : threads)
+			thread.join();
+
+		if (exception)
+			std::rethrow_exception(exception);
+	}
+
+	static inline std::vector<result<app, char_t>> parse(const lines_t& lines, std::size_t thread_count)
+	{
+		std::vector<result<app, char_t>> results(std::size(lines));
+
+		struct worker
+		{
+			std::vector<result<app, char_t>>& m_results;
+
+			inline int make_state() { return 0; }
+			inline void operator()(parser_context<app, char_t>& context, int, std::size_t i, int argc, const char_t** argv)
+			{
+				context.parse_into(m_results[i], argc, argv);
+			}
+		};
+
+		run(lines, thread_count, worker{ results });
+		return results;
+	}
+
+	static inline std::vector<result_error<char_t>> validate(const lines_t& lines, std::size_t thread_count)
+	{
+		std::vector<result_error<char_t>> errors(std::size(lines));
+
+		struct worker
+		{
+			std::vector<result_error<char_t>>& m_errors;
+
+			// one result per worker, reused for every line
+			inline result<app, char_t> make_state() { return {}; }
+			inline void operator()(parser_context<app, char_t>& context, result<app, char_t>& result, std::size_t i, int argc, const char_t** argv)
+			{
+				m_errors[i] = context.parse_into(result, argc, argv).error();
+			}
+		};
+
+		run(lines, thread_count, worker{ errors });
+		return errors;
+	}
+};
+
+_ARGLESS_CORE_END
+
+#endif
+
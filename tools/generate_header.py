@@ -1,12 +1,37 @@
 #!/usr/bin/env python3
 import argparse
 import os
+import re
 import sys
 
 dirs = []
 included_files = set()
+skipped_files = set()
+stripped_files = {}
 output = "#pragma once\n"
 
+# optional parts of include/argless.hpp, feature: (header, required features)
+features = {
+    "fundamental": ("argless/parsers/fundamental_type.hpp", []),
+    "enum": ("argless/parsers/enum.hpp", []),
+    "string": ("argless/parsers/string.hpp", []),
+    "array": ("argless/parsers/array.hpp", []),
+    "dynamic_array": ("argless/parsers/dynamic_array.hpp", []),
+    "path": ("argless/parsers/path.hpp", []),
+    "optional": ("argless/parsers/optional.hpp", []),
+    "variant": ("argless/parsers/variant.hpp", []),
+    "tuple": ("argless/parsers/tuple.hpp", []),
+    "help": ("argless/helper.hpp", []),
+    "completion": ("argless/completion.hpp", ["help"]),
+    "batch": ("argless/batch.hpp", []),
+    "compact": ("argless/compact.hpp", []),
+}
+
+profiles = {
+    "minimal": ["fundamental", "string", "enum"],
+    "all": list(features),
+}
+
 def find_file(file, from_dir):
     def rel_dirs():
         if from_dir is None:
@@ -16,7 +41,7 @@ def find_file(file, from_dir):
 
     if os.path.isabs(file):
         if os.path.isfile(file):
-            return os.path.normpath(file) 
+            return os.path.normpath(file)
     else:
         for d in rel_dirs():
             path = os.path.join(d, file)
@@ -39,10 +64,17 @@ def include_file(file, from_dir):
         output += f"#include <{file}>\n"
         return
 
-    if abs_file in included_files:
+    if abs_file in included_files or abs_file in skipped_files:
         return
     included_files.add(abs_file)
 
+    # stripped files are collected whole and put back once the rest of the output is known
+    if os.path.basename(abs_file) in stripped_files:
+        with open(abs_file, "r", encoding="utf-8") as f:
+            stripped_files[os.path.basename(abs_file)] = f.read()
+        output += f"@@strip:{os.path.basename(abs_file)}@@\n"
+        return
+
     with open(abs_file, "r", encoding="utf-8") as f:
         for line in f:
             stripped = line.strip()
@@ -68,6 +100,205 @@ def include_file(file, from_dir):
             else:
                 output += line
 
+def select_features(names):
+    selected = []
+    def add(name):
+        if name in selected:
+            return
+        if name not in features:
+            raise ValueError(f"unknown feature {name}, known: {', '.join(list(features) + list(profiles))}")
+        for required in features[name][1]:
+            add(required)
+        selected.append(name)
+
+    for name in names:
+        for feature in profiles.get(name, [name]):
+            add(feature)
+    return selected
+
+# same length copy of text where comments, string and char literals are blanked, newlines are kept
+def code_only(text):
+    pattern = re.compile(r"//[^\n]*|/\*.*?\*/|\"(?:\\.|[^\"\\\n])*\"|'(?:\\.|[^'\\\n])*'", re.S)
+    return pattern.sub(lambda m: re.sub(r"[^\n]", " ", m.group(0)), text)
+
+identifier = re.compile(r"[A-Za-z_]\w*")
+
+# name a top-level declaration defines, None when it cannot be told (it is always kept then)
+def without_template_heads(code):
+    code = code.strip()
+    while code.startswith("template"):
+        begin = code.find("<")
+        if begin == -1:
+            return code
+        depth = 0
+        for i in range(begin, len(code)):
+            depth += {"<": 1, ">": -1}.get(code[i], 0)
+            if depth == 0:
+                break
+        code = code[i + 1:].strip()
+    return code
+
+# whether a braced part of a declaration is its initializer (= {...} or = [](){...}()) rather than its body
+def is_initializer(head):
+    depth = 0
+    for m in re.finditer(r"[()]|[=!<>]?=+", without_template_heads(head)):
+        token = m.group(0)
+        depth += {"(": 1, ")": -1}.get(token, 0)
+        if token == "=" and depth == 0:
+            return True
+    return False
+
+def declaration_name(code):
+    code = without_template_heads(code)
+
+    m = re.match(r"(?:struct|class|union)\s+(\w+)", code)
+    if m:
+        return m.group(1)
+    m = re.match(r"using\s+(\w+)\s*=", code)
+    if m:
+        return m.group(1)
+    if re.match(r"(?:static_assert|using|namespace|extern)\b", code):
+        return None
+
+    # functions and variables, last name before the parameter list or initializer
+    depth = 0
+    name = None
+    candidate = None
+    for m in re.finditer(r"[A-Za-z_]\w*|[(){=;]", code):
+        token = m.group(0)
+        if token == "(":
+            if depth == 0 and candidate not in ("decltype", "_tetter_decltype", "noexcept", "alignas", "__attribute__"):
+                name = candidate
+            depth += 1
+        elif token == ")":
+            depth -= 1
+        elif depth == 0 and token in "{=;":
+            return name if name else candidate if token != "{" else None
+        candidate = token
+    return name
+
+# splits [begin, end) of text into top-level declarations, namespaces and the classes in open_classes are split into their members,
+# (begin, end, name) chunks, name is True for parts that are always kept
+def split_declarations(text, code, begin, end, open_classes):
+    chunks = []
+    start = begin
+    depth = 0
+    parens = 0
+    i = begin
+    while i < end:
+        c = code[i]
+        if c == "#" and depth == 0 and not code[start:i].strip():
+            if start < i:
+                chunks.append((start, i, True))
+            line_end = i
+            while True:
+                line_end = code.find("\n", line_end)
+                line_end = end if line_end == -1 or line_end >= end else line_end + 1
+                if line_end >= end or not code[i:line_end].rstrip().endswith("\\"):
+                    break
+            chunks.append((i, line_end, True))
+            start = i = line_end
+            continue
+        if c == "(":
+            parens += 1
+        elif c == ")":
+            parens -= 1
+        elif c == "{":
+            if depth == 0 and parens == 0:
+                head = code[start:i]
+                m = re.match(r"\s*(?:template\s*<.*?>\s*)?(?:struct|class)\s+(\w+)\s*(?::[^{]*)?$", head, re.S)
+                if re.match(r"\s*namespace\b[\w\s:]*$", head) or (m and m.group(1) in open_classes):
+                    close = matching_brace(code, i, end)
+                    chunks.append((start, i + 1, True))
+                    chunks += split_declarations(text, code, i + 1, close, open_classes)
+                    after = close + 1
+                    while after < end and code[after] in " \t":
+                        after += 1
+                    if after < end and code[after] == ";":
+                        after += 1
+                    chunks.append((close, after, True))
+                    start = i = after
+                    continue
+            depth += 1
+        elif c == "}":
+            depth -= 1
+            if depth == 0 and parens == 0:
+                after = i + 1
+                while after < end and code[after] in " \t\r\n":
+                    after += 1
+                if after < end and code[after] == ";":
+                    i = after
+                elif is_initializer(code[start:code.index("{", start)]):
+                    i += 1
+                    continue
+                chunks.append((start, i + 1, declaration_name(code[start:i + 1])))
+                start = i + 1
+        elif c == ";" and depth == 0 and parens == 0:
+            chunks.append((start, i + 1, declaration_name(code[start:i + 1])))
+            start = i + 1
+        elif depth == 0 and parens == 0 and re.match(r"(?:public|private|protected)\s*:", code[i:i + 10]) and not code[start:i].strip():
+            colon = code.index(":", i) + 1
+            chunks.append((start, colon, True))
+            start = i = colon
+            continue
+        i += 1
+    if start < end:
+        chunks.append((start, end, True))
+    return chunks
+
+def matching_brace(code, i, end):
+    depth = 0
+    while i < end:
+        depth += {"{": 1, "}": -1}.get(code[i], 0)
+        if depth == 0:
+            return i
+        i += 1
+    raise ValueError("unbalanced braces")
+
+conditional = re.compile(r"^\s*#\s*(if|ifdef|ifndef|endif)\b", re.M)
+
+# drops declarations of text that nothing in used (or in kept declarations) refers to
+def strip_unused(text, used):
+    code = code_only(text)
+    chunks = split_declarations(text, code, 0, len(code), {"tetter"})
+
+    def removable(chunk):
+        begin, end, name = chunk
+        if name is True or name is None:
+            return False
+        # never split a preprocessor conditional
+        depth = 0
+        for m in conditional.finditer(code, begin, end):
+            depth += -1 if m.group(1) == "endif" else 1
+            if depth < 0:
+                return False
+        return depth == 0
+
+    referenced = set(identifier.findall(code_only(used)))
+    keep = [not removable(chunk) for chunk in chunks]
+    for chunk, kept in zip(chunks, keep):
+        if kept:
+            referenced.update(identifier.findall(code[chunk[0]:chunk[1]]))
+
+    changed = True
+    while changed:
+        changed = False
+        for index, chunk in enumerate(chunks):
+            if not keep[index] and chunk[2] in referenced:
+                keep[index] = True
+                referenced.update(identifier.findall(code[chunk[0]:chunk[1]]))
+                changed = True
+
+    result = "".join(text[chunk[0]:chunk[1]] for chunk, kept in zip(chunks, keep) if kept)
+    # conditionals left empty and runs of blank lines
+    empty = re.compile(r"^[ \t]*#[ \t]*if[^\n]*\n(?:[ \t]*\n)*[ \t]*#[ \t]*endif[^\n]*\n", re.M)
+    while True:
+        reduced = empty.sub("", result)
+        if reduced == result:
+            break
+        result = reduced
+    return re.sub(r"\n[ \t]*(?:\n[ \t]*){2,}\n", "\n\n", result)
+
 def main():
     global output
     global dirs
@@ -75,20 +306,43 @@ def main():
     p = argparse.ArgumentParser()
     p.add_argument('-o', '--output')
     p.add_argument('-I', dest='dirs', action='append', default=[])
+    p.add_argument('--features', help=f"comma separated features or profiles to keep, features: {', '.join(features)}, profiles: {', '.join(profiles)} (default all)")
+    p.add_argument('--strip', action='append', default=[], help="file name (e.g. tetter.hpp) whose declarations unused by the rest of the output are dropped")
     p.add_argument('headers', nargs='+')
     args = p.parse_args()
 
     dirs = [os.path.abspath(d) for d in args.dirs]
 
+    if args.features:
+        try:
+            selected = select_features([f.strip() for f in args.features.split(",") if f.strip()])
+        except ValueError as e:
+            print(f"Error: {e}", file=sys.stderr)
+            return 1
+        for name, (header, _) in features.items():
+            if name not in selected:
+                path = find_file(header, None)
+                if path is not None:
+                    skipped_files.add(path)
+        output += f"// features: {', '.join(selected)}\n"
+
+    for name in args.strip:
+        stripped_files[name] = None
+
     for hdr in args.headers:
         include_file(hdr, os.path.abspath("."))
 
+    for name, text in stripped_files.items():
+        marker = f"@@strip:{name}@@\n"
+        if text is not None:
+            output = output.replace(marker, strip_unused(text, output.replace(marker, "")))
+
     if args.output:
         with open(args.output, "w", encoding="utf-8") as out_f:
             out_f.write(output)
     else:
         print(output)
+    return 0
 
 if __name__ == '__main__':
-    main()
-
+    sys.exit(main())